@@ -1,56 +1,679 @@
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <filesystem>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include "Decoder_LDPC.hpp"
 
 using namespace aff3ct;
 using namespace aff3ct::module;
 
 template <typename B, typename R>
-double Decoder_LDPC<B,R>::CheckNode::calcMessage(int to)
+size_t Decoder_LDPC<B,R>::TannerGraph::blockSize(int variableCount, int checkCount, int edgeCount)
 {
-    double product = 1.0;
-    for (const auto& [index, message] : receivedMessage) {
-        if (index == to) continue;
-        if (std::isinf(message)) {
-            if (message < 0) product *= -1;
-            continue;
+    return (size_t)(checkCount + 1) + (size_t)(variableCount + 1) + 3 * (size_t)edgeCount;
+}
+
+//   -    int32 (  ),   storage:     
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::TannerGraph Decoder_LDPC<B,R>::TannerGraph::attach(const int* block, int variableCount, int checkCount, int edgeCount,
+    std::shared_ptr<const void> storage)
+{
+    TannerGraph graph;
+    graph.variableCount = variableCount;
+    graph.checkCount = checkCount;
+    graph.checkOffsets = IndexArray{ block, (size_t)(checkCount + 1) };
+    graph.edgeVariables = IndexArray{ graph.checkOffsets.end(), (size_t)edgeCount };
+    graph.edgeChecks = IndexArray{ graph.edgeVariables.end(), (size_t)edgeCount };
+    graph.variableOffsets = IndexArray{ graph.edgeChecks.end(), (size_t)(variableCount + 1) };
+    graph.variableEdges = IndexArray{ graph.variableOffsets.end(), (size_t)edgeCount };
+    graph.storage = std::move(storage);
+    return graph;
+}
+
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::TannerGraph Decoder_LDPC<B,R>::TannerGraph::build(int variableCount, int checkCount, const std::vector<Edge>& edges)
+{
+    int edgeCount = (int)edges.size();
+    auto block = std::make_shared<std::vector<int>>(blockSize(variableCount, checkCount, edgeCount), 0);
+    int* checkOffsets = block->data();
+    int* edgeVariables = checkOffsets + checkCount + 1;
+    int* edgeChecks = edgeVariables + edgeCount;
+    int* variableOffsets = edgeChecks + edgeCount;
+    int* variableEdges = variableOffsets + variableCount + 1;
+
+    for (const auto& edge : edges) {
+        checkOffsets[edge.checkNodeIndex + 1]++;
+        variableOffsets[edge.variableNodeIndex + 1]++;
+    }
+    for (int c = 0; c < checkCount; c++) {
+        checkOffsets[c + 1] += checkOffsets[c];
+    }
+    for (int v = 0; v < variableCount; v++) {
+        variableOffsets[v + 1] += variableOffsets[v];
+    }
+
+    //     ,   -    
+    std::vector<int> next(checkOffsets, checkOffsets + checkCount);
+    for (const auto& edge : edges) {
+        edgeVariables[next[edge.checkNodeIndex]++] = edge.variableNodeIndex;
+    }
+    for (int c = 0; c < checkCount; c++) {
+        std::fill(edgeChecks + checkOffsets[c], edgeChecks + checkOffsets[c + 1], c);
+    }
+
+    next.assign(variableOffsets, variableOffsets + variableCount);
+    for (int e = 0; e < edgeCount; e++) {
+        variableEdges[next[edgeVariables[e]]++] = e;
+    }
+    return attach(block->data(), variableCount, checkCount, edgeCount, block);
+}
+
+//     alist  Matrix Market   CSR path + ".csr":    
+//     ,         
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::TannerGraph Decoder_LDPC<B,R>::TannerGraph::load(const std::string& path)
+{
+    std::string cachePath = path + ".csr";
+    std::error_code sourceError, cacheError;
+    auto sourceTime = std::filesystem::last_write_time(path, sourceError);
+    auto cacheTime = std::filesystem::last_write_time(cachePath, cacheError);
+    if (!cacheError && (sourceError || cacheTime >= sourceTime)) {
+        TannerGraph graph = mapCache(cachePath);
+        if (graph.storage) return graph;
+    }
+
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("Cannot open parity-check file: " + path);
+    }
+    int variableCount = 0, checkCount = 0;
+    std::vector<Edge> edges = (in.peek() == '%') ? parseMatrixMarket(in, variableCount, checkCount) : parseAlist(in, variableCount, checkCount);
+    TannerGraph graph = build(variableCount, checkCount, edges);
+    saveCache(graph, cachePath);
+    return graph;
+}
+
+// alist (MacKay): N M,  ,    ,   ( 1)  ;  
+template <typename B, typename R>
+std::vector<typename Decoder_LDPC<B,R>::Edge> Decoder_LDPC<B,R>::TannerGraph::parseAlist(std::istream& in, int& variableCount, int& checkCount)
+{
+    int maxColumnWeight = 0, maxRowWeight = 0;
+    if (!(in >> variableCount >> checkCount >> maxColumnWeight >> maxRowWeight) || variableCount <= 0 || checkCount <= 0) {
+        throw std::invalid_argument("Invalid alist header");
+    }
+    std::vector<int> columnWeights(variableCount), rowWeights(checkCount);
+    for (int& weight : columnWeights) in >> weight;
+    for (int& weight : rowWeights) in >> weight;
+    if (!in) {
+        throw std::invalid_argument("Invalid alist weights");
+    }
+
+    std::vector<Edge> edges;
+    for (int v = 0; v < variableCount; v++) {
+        for (int k = 0; k < columnWeights[v];) {
+            int check = 0;
+            if (!(in >> check) || check < 0 || check > checkCount) {
+                throw std::invalid_argument("Invalid alist column " + std::to_string(v));
+            }
+            if (check == 0) continue;
+            edges.push_back(Edge{ v, check - 1 });
+            k++;
+        }
+    }
+    return edges;
+}
+
+// Matrix Market:  coordinate,  `M N nnz`,  `  []` ( 1);   
+template <typename B, typename R>
+std::vector<typename Decoder_LDPC<B,R>::Edge> Decoder_LDPC<B,R>::TannerGraph::parseMatrixMarket(std::istream& in, int& variableCount, int& checkCount)
+{
+    std::string line;
+    std::getline(in, line);
+    if (line.find("coordinate") == std::string::npos) {
+        throw std::invalid_argument("Only coordinate Matrix Market files are supported");
+    }
+    while (std::getline(in, line) && (line.empty() || line[0] == '%'));
+    long long entryCount = 0;
+    if (!(std::istringstream(line) >> checkCount >> variableCount >> entryCount) || variableCount <= 0 || checkCount <= 0) {
+        throw std::invalid_argument("Invalid Matrix Market size line");
+    }
+
+    std::vector<Edge> edges;
+    edges.reserve(entryCount);
+    for (long long i = 0; i < entryCount; i++) {
+        int row = 0, column = 0;
+        double value = 1;
+        if (!std::getline(in, line)) {
+            throw std::invalid_argument("Unexpected end of Matrix Market file");
+        }
+        std::istringstream fields(line);
+        if (!(fields >> row >> column) || row < 1 || row > checkCount || column < 1 || column > variableCount) {
+            throw std::invalid_argument("Invalid Matrix Market entry: " + line);
+        }
+        fields >> value;
+        if (value != 0) edges.push_back(Edge{ column - 1, row - 1 });
+    }
+    return edges;
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC<B,R>::TannerGraph::saveCache(const TannerGraph& graph, const std::string& cachePath)
+{
+    CacheHeader header = { { 'L', 'D', 'P', 'C', 'C', 'S', 'R', '1' }, graph.variableCount, graph.checkCount, graph.edgeCount(), 0 };
+    std::string temporaryPath = cachePath + "." + std::to_string(std::random_device{}()) + ".tmp";
+    bool written;
+    {
+        std::ofstream out(temporaryPath, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(graph.checkOffsets.data()),
+            blockSize(graph.variableCount, graph.checkCount, graph.edgeCount()) * sizeof(int32_t));
+        written = (bool)out.flush();
+    }
+    std::error_code error;
+    if (written) std::filesystem::rename(temporaryPath, cachePath, error);
+    if (!written || error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
+
+//    ;    storage 
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::TannerGraph Decoder_LDPC<B,R>::TannerGraph::mapCache(const std::string& cachePath)
+{
+    size_t size = 0;
+    std::shared_ptr<const void> mapping = mapFile(cachePath, size);
+    if (!mapping || size < sizeof(CacheHeader)) return TannerGraph();
+
+    const CacheHeader* header = static_cast<const CacheHeader*>(mapping.get());
+    if (std::memcmp(header->magic, "LDPCCSR1", 8) != 0 || header->variableCount < 0 || header->checkCount < 0 || header->edgeCount < 0 ||
+        size != sizeof(CacheHeader) + blockSize(header->variableCount, header->checkCount, header->edgeCount) * sizeof(int32_t)) {
+        return TannerGraph();
+    }
+    TannerGraph graph = attach(reinterpret_cast<const int*>(header + 1), header->variableCount, header->checkCount, header->edgeCount, mapping);
+    if (graph.checkOffsets[graph.checkCount] != header->edgeCount || graph.variableOffsets[graph.variableCount] != header->edgeCount) {
+        return TannerGraph();
+    }
+    return graph;
+}
+
+//      ( POSIX   )
+template <typename B, typename R>
+std::shared_ptr<const void> Decoder_LDPC<B,R>::TannerGraph::mapFile(const std::string& path, size_t& size)
+{
+#ifdef _WIN32
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return nullptr;
+    size = (size_t)in.tellg();
+    auto buffer = std::make_shared<std::vector<int32_t>>((size + sizeof(int32_t) - 1) / sizeof(int32_t));
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(buffer->data()), size)) return nullptr;
+    return std::shared_ptr<const void>(buffer, buffer->data());
+#else
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) return nullptr;
+    struct stat info;
+    void* address = MAP_FAILED;
+    if (fstat(descriptor, &info) == 0 && info.st_size > 0) {
+        size = (size_t)info.st_size;
+        address = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+    }
+    close(descriptor);
+    if (address == MAP_FAILED) return nullptr;
+    return std::shared_ptr<const void>(address, [size](const void* mapped) { munmap(const_cast<void*>(mapped), size); });
+#endif
+}
+
+template <typename B, typename R>
+int Decoder_LDPC<B,R>::TannerGraph::maxCheckDegree() const
+{
+    int degree = 0;
+    for (int c = 0; c < checkCount; c++) {
+        degree = std::max(degree, checkOffsets[c + 1] - checkOffsets[c]);
+    }
+    return degree;
+}
+
+//      :     
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::TannerGraph Decoder_LDPC<B,R>::TannerGraph::withoutVariables(const std::vector<char>& isRemoved) const
+{
+    std::vector<Edge> edges;
+    edges.reserve(edgeCount());
+    for (int c = 0; c < checkCount; c++) {
+        for (int e = checkOffsets[c]; e < checkOffsets[c + 1]; e++) {
+            if (!isRemoved[edgeVariables[e]]) edges.push_back(Edge{ edgeVariables[e], c });
+        }
+    }
+    return build(variableCount, checkCount, edges);
+}
+
+//      (    - ):
+// ,      ,    T,  
+// ( )    - ;   -    T   .
+//   ,     ,        .
+//    :   - AND  XOR  64- ,  T -  
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::SystematicEncoder::encode(uint64_t* words) const
+{
+    for (size_t k = 0; k < pivotColumns.size(); k++) {
+        const uint64_t* row = pivotRows.data() + k * wordCount;
+        uint64_t parity = 0;
+        for (int w = 0; w < wordCount; w++) {
+            parity ^= row[w] & words[w];
+        }
+        setBit(words, pivotColumns[k], __builtin_parityll(parity));
+    }
+    for (size_t t = 0; t < triangularColumns.size(); t++) {
+        int bit = 0;
+        for (int k = triangularOffsets[t]; k < triangularOffsets[t + 1]; k++) {
+            bit ^= getBit(words, triangularInputs[k]);
+        }
+        setBit(words, triangularColumns[t], bit);
+    }
+}
+
+//      [0, systematicColumns):  ,  
+//   ( )   H,  T    
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::SystematicEncoder Decoder_LDPC<B,R>::SystematicEncoder::build(const TannerGraph& graph, int systematicColumns)
+{
+    SystematicEncoder unconstrained = triangulate(graph, 0);
+    if (systematicColumns == 0) return unconstrained;
+
+    std::vector<Edge> parityEdges;
+    for (int c = 0; c < graph.checkCount; c++) {
+        for (int e = graph.checkOffsets[c]; e < graph.checkOffsets[c + 1]; e++) {
+            if (graph.edgeVariables[e] >= systematicColumns) parityEdges.push_back(Edge{ graph.edgeVariables[e] - systematicColumns, c });
         }
-        product *= std::tanh(message / 2);
     }
-    return 2 * std::atanh(product);
+    TannerGraph parityPart = TannerGraph::build(graph.variableCount - systematicColumns, graph.checkCount, parityEdges);
+    if (triangulate(parityPart, 0).rank() != unconstrained.rank()) return unconstrained;
+    return triangulate(graph, systematicColumns);
 }
 
 template <typename B, typename R>
-void Decoder_LDPC<B,R>::CheckNode::receiveMessage(int from, double message)
+typename Decoder_LDPC<B,R>::SystematicEncoder Decoder_LDPC<B,R>::SystematicEncoder::triangulate(const TannerGraph& graph, int systematicColumns)
 {
-    receivedMessage[from] = message;
+    int variableCount = graph.variableCount;
+    int checkCount = graph.checkCount;
+    SystematicEncoder encoder;
+    encoder.variableCount = variableCount;
+    encoder.wordCount = (variableCount + 63) / 64;
+
+    //  H  GF(2):   ( )  
+    std::vector<int> rowOffsets(checkCount + 1, 0), rowColumns;
+    rowColumns.reserve(graph.edgeCount());
+    for (int c = 0; c < checkCount; c++) {
+        size_t begin = rowColumns.size();
+        rowColumns.insert(rowColumns.end(), graph.edgeVariables.begin() + graph.checkOffsets[c], graph.edgeVariables.begin() + graph.checkOffsets[c + 1]);
+        std::sort(rowColumns.begin() + begin, rowColumns.end());
+        size_t end = begin;
+        for (size_t i = begin; i < rowColumns.size();) {
+            size_t j = i;
+            while (j < rowColumns.size() && rowColumns[j] == rowColumns[i]) j++;
+            if ((j - i) % 2) rowColumns[end++] = rowColumns[i];
+            i = j;
+        }
+        rowColumns.resize(end);
+        rowOffsets[c + 1] = (int)end;
+    }
+    std::vector<int> columnOffsets(variableCount + 1, 0), columnRows(rowColumns.size());
+    for (int v : rowColumns) columnOffsets[v + 1]++;
+    for (int v = 0; v < variableCount; v++) columnOffsets[v + 1] += columnOffsets[v];
+    std::vector<int> next(columnOffsets.begin(), columnOffsets.end() - 1);
+    for (int c = 0; c < checkCount; c++) {
+        for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+            columnRows[next[rowColumns[k]]++] = c;
+        }
+    }
+
+    //   T:  -        .
+    //   1 -  ,  >= 2 -     (  ).
+    std::vector<char> isKnown(variableCount, 0), isRowUsed(checkCount, 0), isTriangular(variableCount, 0), isGap(variableCount, 0);
+    std::vector<int> rowDegree(checkCount, 0), columnDegree(variableCount, 0), triangularRows, gapColumns, queue;
+    std::fill(isKnown.begin(), isKnown.begin() + systematicColumns, 1);
+    for (int v = 0; v < variableCount; v++) {
+        columnDegree[v] = columnOffsets[v + 1] - columnOffsets[v];
+    }
+    int maxRowDegree = 0;
+    for (int c = 0; c < checkCount; c++) {
+        for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+            rowDegree[c] += !isKnown[rowColumns[k]];
+        }
+        maxRowDegree = std::max(maxRowDegree, rowDegree[c]);
+    }
+    std::vector<std::vector<int>> buckets(maxRowDegree + 1);
+    auto pushRow = [&](int c) {
+        if (rowDegree[c] == 1) queue.push_back(c);
+        else if (rowDegree[c] >= 2) buckets[rowDegree[c]].push_back(c);
+    };
+    for (int c = 0; c < checkCount; c++) {
+        pushRow(c);
+    }
+    auto markKnown = [&](int v) {
+        isKnown[v] = 1;
+        for (int k = columnOffsets[v]; k < columnOffsets[v + 1]; k++) {
+            int c = columnRows[k];
+            rowDegree[c]--;
+            if (!isRowUsed[c]) pushRow(c);
+        }
+    };
+    size_t head = 0;
+    while (true) {
+        while (head < queue.size()) {
+            int c = queue[head++];
+            if (isRowUsed[c] || rowDegree[c] != 1) continue;
+            int column = -1;
+            for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+                if (!isKnown[rowColumns[k]]) column = rowColumns[k];
+            }
+            isRowUsed[c] = 1;
+            for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+                columnDegree[rowColumns[k]]--;
+            }
+            isTriangular[column] = 1;
+            encoder.triangularColumns.push_back(column);
+            triangularRows.push_back(c);
+            markKnown(column);
+        }
+
+        int best = -1;
+        for (size_t degree = 2; degree < buckets.size() && best < 0; degree++) {
+            while (!buckets[degree].empty() && best < 0) {
+                int c = buckets[degree].back();
+                buckets[degree].pop_back();
+                if (!isRowUsed[c] && rowDegree[c] == (int)degree) best = c;
+            }
+        }
+        if (best < 0) break;
+        int column = -1;
+        for (int k = rowOffsets[best]; k < rowOffsets[best + 1]; k++) {
+            int v = rowColumns[k];
+            if (!isKnown[v] && (column < 0 || columnDegree[v] > columnDegree[column])) column = v;
+        }
+        isGap[column] = 1;
+        gapColumns.push_back(column);
+        markKnown(column);
+    }
+
+    encoder.triangularOffsets.push_back(0);
+    for (size_t t = 0; t < triangularRows.size(); t++) {
+        int c = triangularRows[t];
+        for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+            if (rowColumns[k] != encoder.triangularColumns[t]) encoder.triangularInputs.push_back(rowColumns[k]);
+        }
+        encoder.triangularOffsets.push_back((int)encoder.triangularInputs.size());
+    }
+
+    //     T:      ( 
+    //       T).  : T -   
+    //  [0, triangularWords * 64),  -  ;    T   .
+    int triangularCount = (int)triangularRows.size();
+    int triangularWords = (triangularCount + 63) / 64;
+    std::vector<int> position(variableCount), restColumns;
+    for (int t = 0; t < triangularCount; t++) {
+        position[encoder.triangularColumns[t]] = t;
+    }
+    for (int v : gapColumns) {
+        position[v] = triangularWords * 64 + (int)restColumns.size();
+        restColumns.push_back(v);
+    }
+    for (int v = variableCount - 1; v >= 0; v--) {
+        if (isTriangular[v] || isGap[v]) continue;
+        position[v] = triangularWords * 64 + (int)restColumns.size();
+        restColumns.push_back(v);
+    }
+    int restWords = ((int)restColumns.size() + 63) / 64;
+    std::vector<uint64_t> rows, scratch(triangularWords + restWords);
+    size_t rowCount = 0;
+    for (int c = 0; c < checkCount; c++) {
+        if (isRowUsed[c]) continue;
+        std::fill(scratch.begin(), scratch.end(), 0);
+        for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+            flipBit(scratch.data(), position[rowColumns[k]]);
+        }
+        for (int w = triangularWords - 1; w >= 0; w--) {
+            while (scratch[w]) {
+                int t = w * 64 + 63 - __builtin_clzll(scratch[w]);
+                int r = triangularRows[t];
+                for (int k = rowOffsets[r]; k < rowOffsets[r + 1]; k++) {
+                    flipBit(scratch.data(), position[rowColumns[k]]);
+                }
+            }
+        }
+        rows.insert(rows.end(), scratch.begin() + triangularWords, scratch.end());
+        rowCount++;
+    }
+
+    //  - :  -   ,     ( restColumns)
+    auto row = [&](size_t r) { return rows.data() + r * restWords; };
+    std::vector<char> isPivot(variableCount, 0);
+    std::vector<int> pivotPositions;
+    size_t pivotCount = 0;
+    for (int j = 0; j < (int)restColumns.size() && pivotCount < rowCount; j++) {
+        size_t found = pivotCount;
+        while (found < rowCount && !getBit(row(found), j)) found++;
+        if (found == rowCount) continue;
+        std::swap_ranges(row(found), row(found) + restWords, row(pivotCount));
+        const uint64_t* pivot = row(pivotCount);
+        for (size_t r = 0; r < rowCount; r++) {
+            if (r == pivotCount || !getBit(row(r), j)) continue;
+            uint64_t* target = row(r);
+            for (int w = 0; w < restWords; w++) {
+                target[w] ^= pivot[w];
+            }
+        }
+        isPivot[restColumns[j]] = 1;
+        encoder.pivotColumns.push_back(restColumns[j]);
+        pivotPositions.push_back(j);
+        pivotCount++;
+    }
+
+    //       (  )
+    int wordCount = encoder.wordCount;
+    encoder.pivotRows.assign(pivotCount * wordCount, 0);
+    for (size_t k = 0; k < pivotCount; k++) {
+        flipBit(row(k), pivotPositions[k]);
+        for (int w = 0; w < restWords; w++) {
+            for (uint64_t bits = row(k)[w]; bits; bits &= bits - 1) {
+                flipBit(encoder.pivotRows.data() + k * wordCount, restColumns[w * 64 + __builtin_ctzll(bits)]);
+            }
+        }
+    }
+
+    for (int v = 0; v < variableCount; v++) {
+        if (!isTriangular[v] && !isPivot[v]) encoder.freeColumns.push_back(v);
+    }
+    return encoder;
 }
 
+//    :       64- ,
+//    LLR       
 template <typename B, typename R>
-void Decoder_LDPC<B,R>::CheckNode::clear()
+void Decoder_LDPC<B,R>::SyndromeTracker::reset(int variableCount, int checkCount)
 {
-    receivedMessage.clear();
+    hardDecisions.assign((variableCount + 63) / 64, 0);
+    undecided.assign((variableCount + 63) / 64, ~uint64_t(0));
+    checkParities.assign((checkCount + 63) / 64, 0);
+    unsatisfiedCount = 0;
+    undecidedCount = variableCount;
 }
 
 template <typename B, typename R>
-void Decoder_LDPC<B,R>::VariableNode::setIsFrozen(bool frozen)
+void Decoder_LDPC<B,R>::SyndromeTracker::update(const TannerGraph& graph, int variable, double llr)
+{
+    uint64_t mask = uint64_t(1) << (variable & 63);
+    uint64_t& zero = undecided[variable >> 6];
+    if (((zero & mask) != 0) != (llr == 0)) {
+        zero ^= mask;
+        undecidedCount += (llr == 0) ? 1 : -1;
+    }
+
+    if (getDecision(variable) != (llr < 0)) flip(graph, variable);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::SyndromeTracker::flip(const TannerGraph& graph, int variable)
+{
+    hardDecisions[variable >> 6] ^= uint64_t(1) << (variable & 63);
+    for (int k = graph.variableOffsets[variable]; k < graph.variableOffsets[variable + 1]; k++) {
+        int check = graph.edgeChecks[graph.variableEdges[k]];
+        uint64_t checkMask = uint64_t(1) << (check & 63);
+        uint64_t& parity = checkParities[check >> 6];
+        parity ^= checkMask;
+        unsatisfiedCount += (parity & checkMask) ? 1 : -1;
+    }
+}
+
+//    ( )    
+template <typename B, typename R>
+uint64_t Decoder_LDPC<B,R>::SyndromeTracker::hashDecisions() const
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < hardDecisions.size(); i++) {
+        hash = (hash ^ hardDecisions[i]) * 0x100000001b3ULL;
+        hash = (hash ^ undecided[i]) * 0x100000001b3ULL;
+    }
+    return hash ^ (hash >> 29);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::IterationMonitor::reset()
+{
+    historyCount = 0;
+    stableIterations = plateauIterations = oscillatingIterations = 0;
+    bestUnsatisfiedCount = INT32_MAX;
+}
+
+//    (StoppingCriteria, 0 -  ),     :
+//  -    stagnationIterations  ;  -  oscillationIterations 
+//      historySize   ( );  -   
+// plateauIterations     . hash -    (SyndromeTracker::hashDecisions),
+// unsatisfiedCount -   
+template <typename B, typename R>
+bool Decoder_LDPC<B,R>::IterationMonitor::observe(uint64_t hash, int unsatisfiedCount, const StoppingCriteria& criteria, TerminationReason& reason)
+{
+    bool unchanged = historyCount > 0 && history[(historyCount - 1) % historySize] == hash;
+    bool repeated = false;
+    for (int i = 2; i <= std::min(historyCount, historySize) && !unchanged && !repeated; i++) {
+        repeated = history[(historyCount - i) % historySize] == hash;
+    }
+    history[historyCount % historySize] = hash;
+    historyCount++;
+
+    stableIterations = unchanged ? stableIterations + 1 : 0;
+    oscillatingIterations = repeated ? oscillatingIterations + 1 : 0;
+    if (unsatisfiedCount < bestUnsatisfiedCount) {
+        bestUnsatisfiedCount = unsatisfiedCount;
+        plateauIterations = 0;
+    }
+    else {
+        plateauIterations++;
+    }
+
+    if (criteria.stagnationIterations > 0 && stableIterations >= criteria.stagnationIterations) reason = TerminationReason::Stagnation;
+    else if (criteria.oscillationIterations > 0 && oscillatingIterations >= criteria.oscillationIterations) reason = TerminationReason::Oscillation;
+    else if (criteria.plateauIterations > 0 && plateauIterations >= criteria.plateauIterations) reason = TerminationReason::Plateau;
+    else return false;
+    return true;
+}
+
+//    +-1 (   )
+template <typename B, typename R>
+double Decoder_LDPC<B,R>::CheckNode::tanhHalf(double message)
+{
+    if (std::isinf(message)) return message < 0 ? -1.0 : 1.0;
+    return std::tanh(message / 2);
+}
+
+//  SPA    : outgoing[k]    tanh(m_j / 2)  j > k,
+//      j < k (2dc  tanh  dc^2,     )
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::CheckNode::calcSumProductMessages(const double* incoming, double* outgoing, int degree)
+{
+    double suffix = 1.0;
+    for (int k = degree - 1; k >= 0; k--) {
+        outgoing[k] = suffix;
+        suffix *= tanhHalf(incoming[k]);
+    }
+
+    double prefix = 1.0;
+    for (int k = 0; k < degree; k++) {
+        double product = prefix * outgoing[k];
+        prefix *= tanhHalf(incoming[k]);
+        outgoing[k] = 2 * std::atanh(product);
+    }
+}
+
+// Min-sum:      ,      
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::CheckNode::calcMinSumMessages(const double* incoming, double* outgoing, int degree, double scale, double offset)
+{
+    double min1 = std::numeric_limits<double>::infinity();
+    double min2 = std::numeric_limits<double>::infinity();
+    int minIndex = -1;
+    bool negative = false;
+    for (int k = 0; k < degree; k++) {
+        double message = incoming[k];
+        double magnitude = std::abs(message);
+        if (message < 0) negative = !negative;
+        if (magnitude < min1) {
+            min2 = min1;
+            min1 = magnitude;
+            minIndex = k;
+        }
+        else if (magnitude < min2) {
+            min2 = magnitude;
+        }
+    }
+
+    double corrected1 = std::max(scale * min1 - offset, 0.0);
+    double corrected2 = std::max(scale * min2 - offset, 0.0);
+    for (int k = 0; k < degree; k++) {
+        double magnitude = (k == minIndex) ? corrected2 : corrected1;
+        bool sign = negative != (incoming[k] < 0);
+        outgoing[k] = sign ? -magnitude : magnitude;
+    }
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::VariableNode::setIsFrozen(bool frozen, int bit)
 {
     isFrozen = frozen;
+    frozenBit = bit;
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC<B,R>::VariableNode::getIsFrozen() const
+{
+    return isFrozen;
 }
 
 template <typename B, typename R>
-double Decoder_LDPC<B,R>::VariableNode::calcInitialMessage()
+double Decoder_LDPC<B,R>::VariableNode::calcInitialMessage() const
 {
-    if (isFrozen) return std::numeric_limits<double>::infinity();
+    if (isFrozen) return frozenBit ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
     return channelLLR;
 }
 
 template <typename B, typename R>
-double Decoder_LDPC<B,R>::VariableNode::calcMessage(int to)
+double Decoder_LDPC<B,R>::VariableNode::calcMessage(const double* checkToVariable, const int* edges, int degree, int to) const
 {
-    if (isFrozen) return std::numeric_limits<double>::infinity();
+    if (isFrozen) return calcInitialMessage();
 
     double sum = channelLLR;
-    for (const auto& [index, message] : receivedMessage) {
-        if (index == to) continue;
+    for (int k = 0; k < degree; k++) {
+        if (edges[k] == to) continue;
+        double message = checkToVariable[edges[k]];
         if (std::isinf(message)) return message;
         sum += message;
     }
@@ -58,35 +681,32 @@ double Decoder_LDPC<B,R>::VariableNode::calcMessage(int to)
 }
 
 template <typename B, typename R>
-void Decoder_LDPC<B,R>::VariableNode::receiveMessage(int from, double message)
+double Decoder_LDPC<B,R>::VariableNode::marginalize(const double* checkToVariable, const int* edges, int degree) const
 {
-    receivedMessage[from] = message;
+    return calcMessage(checkToVariable, edges, degree, -1);
 }
 
 template <typename B, typename R>
-double Decoder_LDPC<B,R>::VariableNode::marginalize()
+int Decoder_LDPC<B,R>::VariableNode::estimateSendBit(const double* checkToVariable, const int* edges, int degree, std::mt19937& generator) const
 {
-    return calcMessage(-1);
+    return hardDecision(marginalize(checkToVariable, edges, degree), generator);
 }
 
+//     LLR      (      )
 template <typename B, typename R>
-int Decoder_LDPC<B,R>::VariableNode::estimateSendBit()
+int Decoder_LDPC<B,R>::VariableNode::hardDecision(double llr, std::mt19937& generator)
 {
-    double llr = marginalize();
     if (llr > 0) return 0;
     if (llr < 0) return 1;
 
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
     std::uniform_int_distribution<> dis(0, 1);
-    return (int)dis(gen);
+    return (int)dis(generator);
 }
 
 template <typename B, typename R>
 void Decoder_LDPC<B,R>::VariableNode::clear()
 {
     channelLLR = 0.0;
-    receivedMessage.clear();
 }
 
 template <typename B, typename R>
@@ -97,203 +717,1148 @@ void Decoder_LDPC<B,R>::VariableNode::setChannelLLR(double llr)
 
 template <typename B, typename R>
 Decoder_LDPC<B,R>::Decoder_LDPC(const int K, const int N, const std::vector<int>& frozen_bits)
+: Decoder_LDPC(K, N, frozen_bits, TannerGraph::build(N, 0, std::vector<Edge>()))
+{
+}
+
+//     alist  Matrix Market (    CSR, . TannerGraph::load)
+template <typename B, typename R>
+Decoder_LDPC<B,R>::Decoder_LDPC(const int K, const int N, const std::vector<int>& frozen_bits, const std::string& parityCheckPath)
+: Decoder_LDPC(K, N, frozen_bits, TannerGraph::load(parityCheckPath))
+{
+}
+
+template <typename B, typename R>
+Decoder_LDPC<B,R>::Decoder_LDPC(const int K, const int N, const std::vector<int>& frozen_bits, TannerGraph parityCheckGraph)
+: Decoder_SISO<B,R>(K, N), codeLength(N), graph(std::move(parityCheckGraph))
 {
     const std::string name = "Decoder_LDPC";
     this->set_name(name);
+    if (graph.variableCount != N) {
+        throw std::invalid_argument("Parity-check matrix does not match the code length");
+    }
 
-    //   
-    frozenBitIndexes = frozen_bits;
-    informationBitIndexes.reserve(K);
-    for (int i = 0; i < N; i++) {
-        if (std::find(frozen_bits.begin(), frozen_bits.end(), i) == frozen_bits.end()) {
-            informationBitIndexes.push_back(i);
+    //  ,    -   ,    
+    std::vector<char> isFrozen(N, 0);
+    for (int index : frozen_bits) {
+        if (index < 0 || index >= N) {
+            throw std::invalid_argument("Frozen bit index out of range");
         }
+        isFrozen[index] = 1;
+    }
+    const int unfrozenCount = N - (int)std::count(isFrozen.begin(), isFrozen.end(), 1);
+    if (K < 0 || K > unfrozenCount) {
+        throw std::invalid_argument("K must not exceed the number of non-frozen bits");
+    }
+
+    // K     -    ( ).
+    //      (  ,     ):
+    //  K  ,  ,      
+    auto indexes = std::make_shared<std::vector<int>>();
+    indexes->reserve(N);
+    if (K == unfrozenCount) {
+        for (int i = 0; i < N; i++) {
+            if (!isFrozen[i]) indexes->push_back(i);
+        }
+    }
+    else {
+        auto systematicEncoder = std::make_shared<SystematicEncoder>(SystematicEncoder::build(graph, std::max(0, graph.variableCount - graph.checkCount)));
+        std::vector<char> isFree(N, 0);
+        for (int column : systematicEncoder->freeColumns) {
+            isFree[column] = 1;
+            if (!isFrozen[column] && (int)indexes->size() < K) indexes->push_back(column);
+        }
+        for (int index : frozen_bits) {
+            if (!isFree[index]) {
+                throw std::invalid_argument("Frozen bit " + std::to_string(index) + " is not a free column of the encoder");
+            }
+        }
+        if ((int)indexes->size() < K) {
+            throw std::invalid_argument("Parity-check matrix has fewer than K free non-frozen columns");
+        }
+        encoder = std::move(systematicEncoder);
+    }
+    size_t informationBitCount = indexes->size();
+    indexes->insert(indexes->end(), frozen_bits.begin(), frozen_bits.end());
+    informationBitIndexes = IndexArray{ indexes->data(), informationBitCount };
+    frozenBitIndexes = IndexArray{ indexes->data() + informationBitCount, frozen_bits.size() };
+    bitIndexStorage = std::move(indexes);
+
+    //    ()     :     ,
+    //     0.      (,   )  .
+    //     :         ,
+    //         
+    bool hasFrozenEdges = false;
+    for (int index : frozenBitIndexes) {
+        hasFrozenEdges |= graph.variableOffsets[index + 1] > graph.variableOffsets[index];
+    }
+    if (hasFrozenEdges) {
+        graph = graph.withoutVariables(isFrozen);
     }
 
     //  
-    variableNodes.resize(N);
+    workspace.variableNodes.resize(N);
     for (int index : frozenBitIndexes) {
-        variableNodes[index].setIsFrozen(true);
+        workspace.variableNodes[index].setIsFrozen(true);
+    }
+
+    //        CSR ( )
+    workspace.checkToVariable.assign(graph.edgeCount(), 0.0);
+    workspace.variableToCheck.assign(graph.edgeCount(), 0.0);
+    workspace.aPosterioriLLRs.assign(N, 0.0);
+    workspace.layerMessages.assign(graph.maxCheckDegree(), 0.0);
+    workspace.ambiguousBits.reserve(K);
+
+    //  Q_8/Q_16      
+    if (fixedPoint) {
+        setInterFrame(true);
     }
 }
 
+//          (  ),
+//     ;        
+//  .   -    (    setSeed)
+//    :            setThreadCount
+// ,      -    (       ).
+//       setThreadCount
 template <typename B, typename R>
 Decoder_LDPC<B,R>* Decoder_LDPC<B,R>::clone() const
 {
     auto m = new Decoder_LDPC(*this);
     m->deep_copy(*this);
+    std::vector<DecodingWorkspace>().swap(m->workerWorkspaces);
+    m->threadPool.reset();
+    if (m->threadCount == 0) {
+        m->threadCount = 1;
+    }
+    m->resetWarmStart();
     return m;
 }
 
 template <typename B, typename R>
-bool Decoder_LDPC<B,R>::isSatisfyAllChecks()
+void Decoder_LDPC<B,R>::setCheckNodeRule(CheckNodeRule rule)
 {
-    std::vector<B> estimates(codeLength);
-    for (int i = 0; i < codeLength; i++) {
-        double llr = variableNodes[i].marginalize();
-        if (llr == 0) return false;
-        estimates[i] = (llr < 0) ? 1 : 0;
+    checkNodeRule = rule;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setSchedule(DecodingSchedule decodingSchedule)
+{
+    schedule = decodingSchedule;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setMinSumParameters(double alpha, double beta)
+{
+    if (alpha <= 0 || beta < 0) {
+        throw std::invalid_argument("Invalid min-sum parameters");
     }
+    normalizationFactor = alpha;
+    offsetFactor = beta;
+}
 
-    std::vector<int> checks(checkNodes.size(), 0);
-    for (const auto& edge : edges) {
-        checks[edge.checkNodeIndex] += estimates[edge.variableNodeIndex];
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setInterFrame(bool enabled)
+{
+    interFrame = enabled;
+    this->set_n_frames_per_wave(enabled ? laneCount : 1);
+
+    if (enabled) {
+        laneChannelLLRs.resize(codeLength);
+        laneCheckToVariable.resize(graph.edgeCount());
+        laneVariableToCheck.resize(graph.edgeCount());
+        laneAPosterioriLLRs.resize(codeLength);
+        laneLayerMessages.resize(graph.maxCheckDegree());
+        laneScalarIncoming.resize(graph.maxCheckDegree());
+        laneScalarOutgoing.resize(graph.maxCheckDegree());
+        laneEstimates.resize(codeLength);
+        laneDecisions.resize((size_t)codeLength * laneCount);
+        laneSoftOutputs.resize((size_t)codeLength * laneCount);
+        laneMonitors.resize(laneCount);
+        laneTerminationReasons.resize(laneCount, TerminationReason::IterationLimit);
+        laneIterationCounts.resize(laneCount, 0);
     }
+}
 
-    for (int c : checks) {
-        if (c % 2 != 0) return false;
+//    :   LLR  ,   LLR
+// (        )    
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setFixedPointFormat(int messageBits, int channelBits, int fractionalBits)
+{
+    if (!fixedPoint) {
+        throw std::invalid_argument("Fixed-point format requires an integer LLR type");
+    }
+    if (messageBits < 2 || messageBits > 8 * (int)sizeof(R) || channelBits < 2 || channelBits > messageBits ||
+        fractionalBits < 0 || fractionalBits >= channelBits) {
+        throw std::invalid_argument("Invalid fixed-point format");
+    }
+    messageSaturation = (LaneValue)((1 << (messageBits - 1)) - 1);
+    channelSaturation = (LaneValue)((1 << (channelBits - 1)) - 1);
+    this->fractionalBits = fractionalBits;
+}
+
+//     _decode_siho (1 -   );   
+//        
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setChaseListSize(int listSize)
+{
+    if (listSize < 1 || listSize > maxChaseListSize) {
+        throw std::invalid_argument("Chase list size must be in [1, " + std::to_string(maxChaseListSize) + "]");
+    }
+    chaseListSize = listSize;
+}
+
+//   _decode_siso:  LLR   (  )
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setSoftOutput(SoftOutput output)
+{
+    softOutput = output;
+}
+
+//   _decode_siso:  C2V    ,    
+//  BP    .        resetWarmStart
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setWarmStart(bool enabled)
+{
+    warmStart = enabled;
+    if (!enabled) {
+        resetWarmStart();
+    }
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::resetWarmStart()
+{
+    warmCheckToVariable.clear();
+    warmLaneCheckToVariable.clear();
+}
+
+//         (  40 ,  )
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setStoppingCriteria(const StoppingCriteria& criteria)
+{
+    if (criteria.iterationLimit < 1 || criteria.stagnationIterations < 0 ||
+        criteria.plateauIterations < 0 || criteria.oscillationIterations < 0) {
+        throw std::invalid_argument("Invalid stopping criteria");
+    }
+    stoppingCriteria = criteria;
+}
+
+template <typename B, typename R>
+const StoppingCriteria& Decoder_LDPC<B,R>::getStoppingCriteria() const
+{
+    return stoppingCriteria;
+}
+
+//   BP    (   -    )
+template <typename B, typename R>
+TerminationReason Decoder_LDPC<B,R>::getTerminationReason() const
+{
+    return getTerminationReason(0);
+}
+
+//   BP  frame   (0 <= frame < getInterFrameLevel())   ;
+//       
+template <typename B, typename R>
+TerminationReason Decoder_LDPC<B,R>::getTerminationReason(int frame) const
+{
+    if (frame < 0 || frame >= (interFrame ? laneCount : 1)) {
+        throw std::invalid_argument("Frame index out of the wave");
+    }
+    return interFrame ? laneTerminationReasons[frame] : workspace.terminationReason;
+}
+
+//   BP    (   -    )
+template <typename B, typename R>
+int Decoder_LDPC<B,R>::getIterationCount() const
+{
+    return getIterationCount(0);
+}
+
+//   BP  frame  :    -     
+// (      );  Chase -    BP
+template <typename B, typename R>
+int Decoder_LDPC<B,R>::getIterationCount(int frame) const
+{
+    if (frame < 0 || frame >= (interFrame ? laneCount : 1)) {
+        throw std::invalid_argument("Frame index out of the wave");
+    }
+    return interFrame ? laneIterationCounts[frame] : workspace.iterationCount;
+}
+
+//     ,   
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setThreadCount(int threadCount)
+{
+    if (threadCount < 1) {
+        throw std::invalid_argument("Thread count must be positive");
+    }
+    this->threadCount = threadCount;
+    threadPool = std::make_shared<tools::Thread_Pool>(threadCount - 1);
+}
+
+//   ,      
+template <typename B, typename R>
+bool Decoder_LDPC<B,R>::isSatisfyAllChecks(const DecodingWorkspace& ws) const
+{
+    return ws.syndrome.isSatisfied();
+}
+
+//  :     -  
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::startIterations(DecodingWorkspace& ws) const
+{
+    ws.iterationCount = 0;
+    ws.terminationReason = TerminationReason::IterationLimit;
+    ws.iterationMonitor.reset();
+}
+
+//  :  , ,   , ; true -  
+template <typename B, typename R>
+bool Decoder_LDPC<B,R>::isIterationFinal(DecodingWorkspace& ws, const std::atomic<bool>* cancel) const
+{
+    ws.iterationCount++;
+    if (isSatisfyAllChecks(ws)) {
+        ws.terminationReason = TerminationReason::Converged;
+        return true;
+    }
+    if (ws.iterationMonitor.observe(ws.syndrome.hashDecisions(), ws.syndrome.unsatisfiedCount, stoppingCriteria, ws.terminationReason)) return true;
+    if (cancel && cancel->load(std::memory_order_relaxed)) {
+        ws.terminationReason = TerminationReason::Cancelled;
+        return true;
+    }
+    return false;
+}
+
+template <typename B, typename R>
+double Decoder_LDPC<B,R>::marginalize(const DecodingWorkspace& ws, int variable) const
+{
+    int begin = graph.variableOffsets[variable];
+    int degree = graph.variableOffsets[variable + 1] - begin;
+    return ws.variableNodes[variable].marginalize(ws.checkToVariable.data(), graph.variableEdges.data() + begin, degree);
+}
+
+template <typename B, typename R>
+int Decoder_LDPC<B,R>::estimateSendBit(DecodingWorkspace& ws, int variable) const
+{
+    int begin = graph.variableOffsets[variable];
+    int degree = graph.variableOffsets[variable + 1] - begin;
+    return ws.variableNodes[variable].estimateSendBit(ws.checkToVariable.data(), graph.variableEdges.data() + begin, degree, ws.generator);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::estimateInformationBits(DecodingWorkspace& ws, B* V_K) const
+{
+    for (size_t i = 0; i < informationBitIndexes.size(); i++) {
+        V_K[i] = (B)estimateSendBit(ws, informationBitIndexes[i]);
+    }
+}
+
+//  count  ws.ambiguousBits -     (   K,   )
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::selectAmbiguousBits(DecodingWorkspace& ws, int count) const
+{
+    ws.ambiguousBits.clear();
+    for (int index : informationBitIndexes) {
+        ws.ambiguousBits.emplace_back(index, marginalize(ws, index));
+    }
+    std::partial_sort(ws.ambiguousBits.begin(), ws.ambiguousBits.begin() + count, ws.ambiguousBits.end(), [](const auto& a, const auto& b) {
+        return std::abs(a.second) < std::abs(b.second);
+        });
+    ws.ambiguousBits.resize(count);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::calcCheckMessages(const double* incoming, double* outgoing, int degree) const
+{
+    switch (checkNodeRule) {
+    case CheckNodeRule::SumProduct:
+        CheckNode::calcSumProductMessages(incoming, outgoing, degree);
+        break;
+    case CheckNodeRule::MinSum:
+        CheckNode::calcMinSumMessages(incoming, outgoing, degree, 1.0, 0.0);
+        break;
+    case CheckNodeRule::NormalizedMinSum:
+        CheckNode::calcMinSumMessages(incoming, outgoing, degree, normalizationFactor, 0.0);
+        break;
+    case CheckNodeRule::OffsetMinSum:
+        CheckNode::calcMinSumMessages(incoming, outgoing, degree, 1.0, offsetFactor);
+        break;
     }
-    return true;
 }
 
+//  LLR     AFF3CT   R;  LLR 
+// (fractionalBits),    ,    SPA,    
 template <typename B, typename R>
-void Decoder_LDPC<B,R>::executeMessagePassing(const std::vector<double>& channelOutputs)
+void Decoder_LDPC<B,R>::executeMessagePassing(DecodingWorkspace& ws, const R* Y_N)
 {
+    const double scale = fixedPoint ? (double)(1 << fractionalBits) : 1.0;
+
     //      chanelLLR 
     for (int i = 0; i < codeLength; i++) {
-        variableNodes[i].setChannelLLR(channelOutputs[i]);
+        ws.variableNodes[i].setChannelLLR((double)Y_N[i] / scale);
+    }
+
+    executeSchedule(ws, nullptr);
+}
+
+//      (    )
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::prepareWorkerWorkspaces()
+{
+    if (!threadPool) {
+        setThreadCount(threadCount > 0 ? threadCount : std::max(1, (int)std::thread::hardware_concurrency()));
+    }
+    while ((int)workerWorkspaces.size() < threadPool->getWorkerCount()) {
+        workerWorkspaces.push_back(workspace);
+        seedWorker(workerWorkspaces.back(), (int)workerWorkspaces.size());
+    }
+}
+
+//   worker ( 1)      ;
+//   -1 - c    c  
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::seedWorker(DecodingWorkspace& ws, int worker) const
+{
+    std::seed_seq sequence{ seed, (uint32_t)worker };
+    ws.generator.seed(sequence);
+}
+
+//       LLR (  std::mt19937::default_seed):
+//        
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::setSeed(const uint32_t seed)
+{
+    this->seed = seed;
+    workspace.generator.seed(this->seed);
+    for (size_t w = 0; w < workerWorkspaces.size(); w++) {
+        seedWorker(workerWorkspaces[w], (int)w + 1);
+    }
+}
+
+// cancel -   ,     (   StoppingCriteria)
+// warm -     C2V  ( )  
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::executeSchedule(DecodingWorkspace& ws, const std::atomic<bool>* cancel, bool warm)
+{
+    if (schedule == DecodingSchedule::Layered) {
+        executeLayeredSchedule(ws, cancel, warm);
     }
+    else {
+        executeFloodingSchedule(ws, cancel, warm);
+    }
+}
 
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::executeFloodingSchedule(DecodingWorkspace& ws, const std::atomic<bool>* cancel, bool warm)
+{
     //   :        
-    for (int i = 0; i < (int)edges.size(); i++) {
-        const auto& edge = edges[i];
-        double message = variableNodes[edge.variableNodeIndex].calcInitialMessage();
-        checkNodes[edge.checkNodeIndex].receiveMessage(i, message);
+    // (   -     C2V)
+    for (int v = 0; v < codeLength; v++) {
+        const int* variableEdges = graph.variableEdges.data() + graph.variableOffsets[v];
+        int degree = graph.variableOffsets[v + 1] - graph.variableOffsets[v];
+        for (int k = 0; k < degree; k++) {
+            ws.variableToCheck[variableEdges[k]] = warm
+                ? ws.variableNodes[v].calcMessage(ws.checkToVariable.data(), variableEdges, degree, variableEdges[k])
+                : ws.variableNodes[v].calcInitialMessage();
+        }
     }
 
+    ws.syndrome.reset(codeLength, graph.checkCount);
+    startIterations(ws);
+
     //    
-    for (int iter = 0; iter < decodeIteration; iter++) {
+    for (int iter = 0; iter < stoppingCriteria.iterationLimit; iter++) {
         //          
-        for (int i = 0; i < (int)edges.size(); i++) {
-            const auto& edge = edges[i];
-            double message = checkNodes[edge.checkNodeIndex].calcMessage(i);
-            variableNodes[edge.variableNodeIndex].receiveMessage(i, message);
+        for (int c = 0; c < graph.checkCount; c++) {
+            int begin = graph.checkOffsets[c];
+            calcCheckMessages(ws.variableToCheck.data() + begin, ws.checkToVariable.data() + begin, graph.checkOffsets[c + 1] - begin);
         }
 
         //       
-        for (int i = 0; i < (int)edges.size(); i++) {
-            const auto& edge = edges[i];
-            double message = variableNodes[edge.variableNodeIndex].calcMessage(i);
-            checkNodes[edge.checkNodeIndex].receiveMessage(i, message);
+        for (int v = 0; v < codeLength; v++) {
+            const int* variableEdges = graph.variableEdges.data() + graph.variableOffsets[v];
+            int degree = graph.variableOffsets[v + 1] - graph.variableOffsets[v];
+            for (int k = 0; k < degree; k++) {
+                ws.variableToCheck[variableEdges[k]] = ws.variableNodes[v].calcMessage(ws.checkToVariable.data(), variableEdges, degree, variableEdges[k]);
+            }
+            ws.syndrome.update(graph, v, ws.variableNodes[v].marginalize(ws.checkToVariable.data(), variableEdges, degree));
         }
 
-        //  ,    
-        if (isSatisfyAllChecks()) break;
+        //  :       
+        if (isIterationFinal(ws, cancel)) break;
     }
 }
 
+//  : V2C =  LLR -  C2V,  C2V    LLR
+//     LLR      C2V
 template <typename B, typename R>
-std::vector<int> Decoder_LDPC<B,R>::decode(const std::vector<double>& channelOutputs)
+void Decoder_LDPC<B,R>::executeLayeredSchedule(DecodingWorkspace& ws, const std::atomic<bool>* cancel, bool warm)
 {
-    executeMessagePassing(channelOutputs);
-    std::vector<int> decoded;
-    for (int index : informationBitIndexes) {
-        decoded.push_back(variableNodes[index].estimateSendBit());
+    for (int v = 0; v < codeLength; v++) {
+        ws.aPosterioriLLRs[v] = warm ? marginalize(ws, v) : ws.variableNodes[v].calcInitialMessage();
+    }
+    if (!warm) {
+        std::fill(ws.checkToVariable.begin(), ws.checkToVariable.end(), 0.0);
+    }
+    ws.syndrome.reset(codeLength, graph.checkCount);
+    startIterations(ws);
+
+    for (int iter = 0; iter < stoppingCriteria.iterationLimit; iter++) {
+        for (int c = 0; c < graph.checkCount; c++) {
+            int begin = graph.checkOffsets[c];
+            int degree = graph.checkOffsets[c + 1] - begin;
+            const int* variables = graph.edgeVariables.data() + begin;
+            double* messages = ws.checkToVariable.data() + begin;
+
+            for (int k = 0; k < degree; k++) {
+                double llr = ws.aPosterioriLLRs[variables[k]];
+                ws.layerMessages[k] = std::isinf(llr) ? llr : llr - messages[k];
+            }
+
+            calcCheckMessages(ws.layerMessages.data(), messages, degree);
+
+            //   ( LLR = Inf)  
+            for (int k = 0; k < degree; k++) {
+                messages[k] = std::clamp(messages[k], -layeredMessageLimit, layeredMessageLimit);
+                double& llr = ws.aPosterioriLLRs[variables[k]];
+                if (!std::isinf(llr)) llr = ws.layerMessages[k] + messages[k];
+            }
+        }
+
+        for (int v = 0; v < codeLength; v++) {
+            ws.syndrome.update(graph, v, ws.aPosterioriLLRs[v]);
+        }
+        if (isIterationFinal(ws, cancel)) break;
+    }
+}
+
+// ==================================================================================== inter-frame (SIMD) mode
+//   :  /  l -  l   LaneVector,
+//          laneCount .
+
+//      ( R)  :     
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::LaneMask Decoder_LDPC<B,R>::isInfinite(const LaneVector& x)
+{
+    if constexpr (fixedPoint) {
+        return LaneMask{};
+    }
+    else {
+        const LaneValue infinity = std::numeric_limits<LaneValue>::infinity();
+        return (x == infinity) | (x == -infinity);
     }
-    return decoded;
 }
 
+//          (__builtin_convertvector  :
+// ,  32- LaneAccumulator,   ABI  AVX)    
 template <typename B, typename R>
-std::vector<int> Decoder_LDPC<B, R>::selectBestCandidate(
-    const std::vector<std::vector<int>>& candidates,
-    const std::vector<double>& channelOutputs)
+typename Decoder_LDPC<B,R>::LaneVector Decoder_LDPC<B,R>::saturate(const LaneAccumulator& x) const
 {
-    if (candidates.empty()) return {};
+    if constexpr (fixedPoint) {
+        const AccumulatorValue limit = messageSaturation;
+        const AccumulatorValue negativeLimit = -limit;
+        LaneAccumulator clamped = (x > limit) ? LaneAccumulator{} + limit : x;
+        clamped = (clamped < negativeLimit) ? LaneAccumulator{} + negativeLimit : clamped;
+        return __builtin_convertvector(clamped, LaneVector);
+    }
+    else {
+        return x;
+    }
+}
 
-    //  1:    ( )
-    for (const auto& candidate : candidates) {
-        //   candidate  variableNodes   isSatisfyAllChecks()
-        for (size_t i = 0; i < informationBitIndexes.size(); i++) {
-            int index = informationBitIndexes[i];
-            variableNodes[index].setChannelLLR(candidate[i] ? -1.0 : 1.0); //  LLR  
+//   min-sum: alpha * min (alpha  4     )  max(min - beta, 0)
+template <typename B, typename R>
+typename Decoder_LDPC<B,R>::LaneVector Decoder_LDPC<B,R>::correctMagnitude(const LaneVector& magnitude) const
+{
+    if constexpr (fixedPoint) {
+        LaneAccumulator wide = __builtin_convertvector(magnitude, LaneAccumulator);
+        if (checkNodeRule == CheckNodeRule::NormalizedMinSum) {
+            wide = (wide * (AccumulatorValue)std::lround(normalizationFactor * 16)) >> 4;
         }
-        if (isSatisfyAllChecks()) {
-            return candidate;
+        if (checkNodeRule == CheckNodeRule::OffsetMinSum) {
+            wide -= (AccumulatorValue)std::lround(offsetFactor * (1 << fractionalBits));
+            wide = (wide < 0) ? LaneAccumulator{} : wide;
         }
+        return saturate(wide);
     }
+    else {
+        LaneValue scale = 1, offset = 0;
+        if (checkNodeRule == CheckNodeRule::NormalizedMinSum) scale = (LaneValue)normalizationFactor;
+        if (checkNodeRule == CheckNodeRule::OffsetMinSum) offset = (LaneValue)offsetFactor;
+        LaneVector corrected = scale * magnitude - offset;
+        return (corrected < 0) ? LaneVector{} : corrected;
+    }
+}
 
-    //  2:     |LLR| ( )
-    std::vector<int> bestCandidate;
-    double maxLLRSum = -1.0;
-    for (const auto& candidate : candidates) {
-        double llrSum = 0.0;
-        for (size_t i = 0; i < candidate.size(); i++) {
-            int index = informationBitIndexes[i];
-            llrSum += std::abs(variableNodes[index].marginalize());
+//  SPA  :  tanh ,         
+//       CheckNode::calcSumProductMessages (2dc  tanh    dc^2).
+//     ,    .
+//  -DDECODER_LDPC_CHECK_LANES (R   )       calcCheckMessages.
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::calcLaneCheckMessages(const Lanes* incoming, Lanes* outgoing, int degree)
+{
+    if (checkNodeRule == CheckNodeRule::SumProduct) {
+        const double scale = fixedPoint ? (double)(1 << fractionalBits) : 1.0;
+        for (int l = 0; l < laneCount; l++) {
+            for (int k = 0; k < degree; k++) {
+                laneScalarIncoming[k] = incoming[k].v[l] / scale;
+            }
+            CheckNode::calcSumProductMessages(laneScalarIncoming.data(), laneScalarOutgoing.data(), degree);
+            for (int k = 0; k < degree; k++) {
+                double message = laneScalarOutgoing[k] * scale;
+                if (fixedPoint) message = std::round(std::clamp(message, -(double)messageSaturation, (double)messageSaturation));
+                outgoing[k].v[l] = (LaneValue)message;
+            }
         }
-        if (llrSum > maxLLRSum) {
-            maxLLRSum = llrSum;
-            bestCandidate = candidate;
+    }
+    else {
+        calcLaneMinSumMessages(incoming, outgoing, degree);
+    }
+
+#ifdef DECODER_LDPC_CHECK_LANES
+    if constexpr (!fixedPoint) {
+        for (int l = 0; l < laneCount; l++) {
+            for (int k = 0; k < degree; k++) {
+                laneScalarIncoming[k] = incoming[k].v[l];
+            }
+            calcCheckMessages(laneScalarIncoming.data(), laneScalarOutgoing.data(), degree);
+            for (int k = 0; k < degree; k++) {
+                double expected = (LaneValue)laneScalarOutgoing[k];
+                double actual = outgoing[k].v[l];
+                bool equal = (std::isinf(expected) || std::isinf(actual)) ? expected == actual
+                    : std::abs(actual - expected) <= 1e-5 * std::max(1.0, std::abs(expected));
+                if (!equal) {
+                    throw std::runtime_error("Inter-frame check node messages differ from the scalar rule");
+                }
+            }
         }
     }
-    return bestCandidate;
+#endif
 }
 
+// Min-sum  :        
 template <typename B, typename R>
-std::vector<std::vector<int>> Decoder_LDPC<B,R>::listDecode(const std::vector<double>& channelOutputs, int listSize)
+void Decoder_LDPC<B,R>::calcLaneMinSumMessages(const Lanes* incoming, Lanes* outgoing, int degree) const
 {
-    executeMessagePassing(channelOutputs);
+    const LaneVector zero = {};
+    LaneVector min1 = zero + (fixedPoint ? std::numeric_limits<LaneValue>::max() : std::numeric_limits<LaneValue>::infinity());
+    LaneVector min2 = min1;
+    LaneMask negative = {};
+    for (int k = 0; k < degree; k++) {
+        LaneVector message = incoming[k].v;
+        LaneVector magnitude = (message < 0) ? -message : message;
+        negative ^= (message < 0);
+        min2 = (magnitude < min1) ? min1 : ((magnitude < min2) ? magnitude : min2);
+        min1 = (magnitude < min1) ? magnitude : min1;
+    }
 
-    //    
-    std::vector<std::pair<int, double>> llrs;
-    for (int index : informationBitIndexes) {
-        double llr = variableNodes[index].marginalize();
-        llrs.emplace_back(index, llr);
+    LaneVector corrected1 = correctMagnitude(min1);
+    LaneVector corrected2 = correctMagnitude(min2);
+
+    //      min2 (   min1 == min2)
+    for (int k = 0; k < degree; k++) {
+        LaneVector message = incoming[k].v;
+        LaneVector magnitude = (message < 0) ? -message : message;
+        LaneVector result = (magnitude == min1) ? corrected2 : corrected1;
+        outgoing[k].v = (negative ^ (message < 0)) ? -result : result;
     }
+}
 
-    //    (   0)
-    std::sort(llrs.begin(), llrs.end(), [](const auto& a, const auto& b) {
-        return std::abs(a.second) < std::abs(b.second);
-        });
+//  V2C   ( ):     
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::calcLaneVariableMessages()
+{
+    const LaneVector zero = {};
+    for (int v = 0; v < codeLength; v++) {
+        const int* variableEdges = graph.variableEdges.data() + graph.variableOffsets[v];
+        int degree = graph.variableOffsets[v + 1] - graph.variableOffsets[v];
+        if (workspace.variableNodes[v].getIsFrozen()) {
+            for (int k = 0; k < degree; k++) {
+                laneVariableToCheck[variableEdges[k]] = laneChannelLLRs[v];
+            }
+            continue;
+        }
+        for (int k = 0; k < degree; k++) {
+            LaneAccumulator sum = __builtin_convertvector(laneChannelLLRs[v].v, LaneAccumulator);
+            LaneVector hard = zero;
+            for (int j = 0; j < degree; j++) {
+                if (j == k) continue;
+                LaneVector message = laneCheckToVariable[variableEdges[j]].v;
+                LaneMask infinite = isInfinite(message);
+                hard = ((hard == 0) & infinite) ? message : hard;
+                sum += __builtin_convertvector(infinite ? zero : message, LaneAccumulator);
+            }
+            laneVariableToCheck[variableEdges[k]].v = (hard != 0) ? hard : saturate(sum);
+        }
+    }
+}
 
-    //    
-    std::vector<int> uniqueDecoded;
-    for (int index : informationBitIndexes) {
-        uniqueDecoded.push_back(variableNodes[index].estimateSendBit());
+//  LLR   ( ):   Inf ,   VariableNode::calcMessage
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::calcLaneMarginals()
+{
+    const LaneVector zero = {};
+    for (int v = 0; v < codeLength; v++) {
+        const int* variableEdges = graph.variableEdges.data() + graph.variableOffsets[v];
+        int degree = graph.variableOffsets[v + 1] - graph.variableOffsets[v];
+        LaneAccumulator sum = __builtin_convertvector(laneChannelLLRs[v].v, LaneAccumulator);
+        LaneVector hard = isInfinite(laneChannelLLRs[v].v) ? laneChannelLLRs[v].v : zero;
+        for (int k = 0; k < degree; k++) {
+            LaneVector message = laneCheckToVariable[variableEdges[k]].v;
+            LaneMask infinite = isInfinite(message);
+            hard = ((hard == 0) & infinite) ? message : hard;
+            sum += __builtin_convertvector(infinite ? zero : message, LaneAccumulator);
+        }
+        laneAPosterioriLLRs[v].v = (hard != 0) ? hard : saturate(sum);
     }
+}
 
-    std::vector<std::vector<int>> listDecoded = { uniqueDecoded };
+//      LLR  lane (      )
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::latchLane(int lane)
+{
+    for (int v = 0; v < codeLength; v++) {
+        LaneValue llr = laneAPosterioriLLRs[v].v[lane];
+        laneDecisions[(size_t)lane * codeLength + v] = (B)VariableNode::hardDecision(llr, workspace.generator);
+        laneSoftOutputs[(size_t)lane * codeLength + v] = llr;
+    }
+}
 
-    //   ,    
-    int ambiguousBitCount = std::floor(std::log2(listSize));
-    for (int i = 0; i < ambiguousBitCount; i++) {
-        auto [index, _] = llrs[i];
-        std::vector<std::vector<int>> temp;
-        for (const auto& v : listDecoded) {
-            std::vector<int> inverted = v;
-            inverted[index] = 1 - inverted[index];
-            temp.push_back(inverted);
+//      : ,    ,   
+//   Converged;     StoppingCriteria  IterationMonitor
+// (      -   SyndromeTracker)    
+//     . finished - ,    
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::latchFinishedLanes(bool* finished)
+{
+    const bool monitored = stoppingCriteria.stagnationIterations > 0 || stoppingCriteria.plateauIterations > 0 ||
+        stoppingCriteria.oscillationIterations > 0;
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t hashes[laneCount], decisionWords[laneCount] = {}, undecidedWords[laneCount] = {};
+    std::fill(hashes, hashes + laneCount, 0xcbf29ce484222325ULL);
+
+    LaneMask unsatisfied = {};
+    for (int v = 0; v < codeLength; v++) {
+        laneEstimates[v].v = laneAPosterioriLLRs[v].v < 0;
+        LaneMask undecided = laneAPosterioriLLRs[v].v == 0;
+        unsatisfied |= undecided;
+        if (!monitored) continue;
+
+        for (int l = 0; l < laneCount; l++) {
+            decisionWords[l] |= uint64_t(laneEstimates[v].v[l] != 0) << (v & 63);
+            undecidedWords[l] |= uint64_t(undecided[l] != 0) << (v & 63);
+        }
+        if ((v & 63) == 63 || v == codeLength - 1) {
+            for (int l = 0; l < laneCount; l++) {
+                hashes[l] = (hashes[l] ^ decisionWords[l]) * prime;
+                hashes[l] = (hashes[l] ^ undecidedWords[l]) * prime;
+                decisionWords[l] = undecidedWords[l] = 0;
+            }
+        }
+    }
+
+    int unsatisfiedCounts[laneCount] = {};
+    for (int c = 0; c < graph.checkCount; c++) {
+        LaneMask parity = {};
+        for (int e = graph.checkOffsets[c]; e < graph.checkOffsets[c + 1]; e++) {
+            parity ^= laneEstimates[graph.edgeVariables[e]].v;
+        }
+        unsatisfied |= parity;
+        if (!monitored) continue;
+        for (int l = 0; l < laneCount; l++) {
+            unsatisfiedCounts[l] += parity[l] != 0;
+        }
+    }
+
+    for (int l = 0; l < laneCount; l++) {
+        if (finished[l]) continue;
+        if (!unsatisfied[l]) {
+            laneTerminationReasons[l] = TerminationReason::Converged;
+        }
+        else if (!monitored || !laneMonitors[l].observe(hashes[l] ^ (hashes[l] >> 29), unsatisfiedCounts[l],
+            stoppingCriteria, laneTerminationReasons[l])) {
+            continue;
+        }
+        finished[l] = true;
+        latchLane(l);
+    }
+}
+
+// warm -    laneCheckToVariable (  _decode_siso)
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::executeInterFrameMessagePassing(const R* Y_N, bool warm)
+{
+    //  : +Inf (   -  ),  LLR  channelSaturation
+    const LaneVector zero = {};
+    for (int v = 0; v < codeLength; v++) {
+        bool frozen = workspace.variableNodes[v].getIsFrozen();
+        for (int l = 0; l < laneCount; l++) {
+            R llr = Y_N[(size_t)l * codeLength + v];
+            if (fixedPoint) llr = std::clamp<R>(llr, -channelSaturation, channelSaturation);
+            laneChannelLLRs[v].v[l] = frozen ? messageSaturation : (LaneValue)llr;
+        }
+    }
+
+    if (schedule == DecodingSchedule::Layered) {
+        if (warm) {
+            calcLaneMarginals();
+            for (int v = 0; v < codeLength; v++) {
+                if (workspace.variableNodes[v].getIsFrozen()) laneAPosterioriLLRs[v] = laneChannelLLRs[v];
+            }
+        }
+        else {
+            laneAPosterioriLLRs = laneChannelLLRs;
+            std::fill(laneCheckToVariable.begin(), laneCheckToVariable.end(), Lanes{ zero });
+        }
+    }
+    else if (warm) {
+        calcLaneVariableMessages();
+    }
+    else {
+        for (int e = 0; e < graph.edgeCount(); e++) {
+            laneVariableToCheck[e] = laneChannelLLRs[graph.edgeVariables[e]];
+        }
+    }
+
+    //       :  ,   ,
+    //       StoppingCriteria,     
+    bool finished[laneCount] = {};
+    for (int l = 0; l < laneCount; l++) {
+        laneMonitors[l].reset();
+        laneTerminationReasons[l] = TerminationReason::IterationLimit;
+        laneIterationCounts[l] = 0;
+    }
+    for (int iter = 0; iter < stoppingCriteria.iterationLimit; iter++) {
+        if (schedule == DecodingSchedule::Layered) {
+            const LaneValue limit = fixedPoint ? channelSaturation : (LaneValue)layeredMessageLimit;
+            const LaneValue negativeLimit = -limit;
+            for (int c = 0; c < graph.checkCount; c++) {
+                int begin = graph.checkOffsets[c];
+                int degree = graph.checkOffsets[c + 1] - begin;
+                const int* variables = graph.edgeVariables.data() + begin;
+                Lanes* messages = laneCheckToVariable.data() + begin;
+
+                for (int k = 0; k < degree; k++) {
+                    LaneVector llr = laneAPosterioriLLRs[variables[k]].v;
+                    bool frozen = workspace.variableNodes[variables[k]].getIsFrozen();
+                    LaneAccumulator extrinsic = __builtin_convertvector(llr, LaneAccumulator) - __builtin_convertvector(messages[k].v, LaneAccumulator);
+                    laneLayerMessages[k].v = frozen ? llr : saturate(extrinsic);
+                }
+
+                calcLaneCheckMessages(laneLayerMessages.data(), messages, degree);
+
+                for (int k = 0; k < degree; k++) {
+                    LaneVector message = messages[k].v;
+                    message = (message > limit) ? zero + limit : message;
+                    message = (message < negativeLimit) ? zero + negativeLimit : message;
+                    messages[k].v = message;
+                    if (!workspace.variableNodes[variables[k]].getIsFrozen()) {
+                        LaneAccumulator sum = __builtin_convertvector(laneLayerMessages[k].v, LaneAccumulator) + __builtin_convertvector(message, LaneAccumulator);
+                        laneAPosterioriLLRs[variables[k]].v = saturate(sum);
+                    }
+                }
+            }
         }
-        listDecoded.insert(listDecoded.end(), temp.begin(), temp.end());
+        else {
+            for (int c = 0; c < graph.checkCount; c++) {
+                int begin = graph.checkOffsets[c];
+                calcLaneCheckMessages(laneVariableToCheck.data() + begin, laneCheckToVariable.data() + begin, graph.checkOffsets[c + 1] - begin);
+            }
+
+            calcLaneVariableMessages();
+            calcLaneMarginals();
+        }
+
+        for (int l = 0; l < laneCount; l++) {
+            if (!finished[l]) laneIterationCounts[l] = iter + 1;
+        }
+        latchFinishedLanes(finished);
+        if (std::all_of(finished, finished + laneCount, [](bool f) { return f; })) return;
+    }
+
+    // ,    iterationLimit ,    
+    for (int l = 0; l < laneCount; l++) {
+        if (!finished[l]) latchLane(l);
+    }
+}
+
+//  K   U_K    X_N (  - )  ,
+//      . ,  K    
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::encode(const B* U_K, B* X_N)
+{
+    if (!encoder) {
+        throw std::runtime_error("Encoding needs K below the number of non-frozen bits");
+    }
+    codewordWords.assign(encoder->wordCount, 0);
+    for (size_t i = 0; i < informationBitIndexes.size(); i++) {
+        if (U_K[i] & 1) SystematicEncoder::flipBit(codewordWords.data(), informationBitIndexes[i]);
     }
+    encoder->encode(codewordWords.data());
+    for (int v = 0; v < codeLength; v++) {
+        X_N[v] = (B)SystematicEncoder::getBit(codewordWords.data(), v);
+    }
+}
 
-    //   
-    return selectBestCandidate(listDecoded, channelOutputs);
+//    :     ,    
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::decode(const R* Y_N, B* V_K)
+{
+    executeMessagePassing(workspace, Y_N);
+    estimateInformationBits(workspace, V_K);
 }
 
+//       :     ,
+//    ( |LLR|  )   .
+//    ,   ;  -    
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::selectBestCandidate(DecodingWorkspace& ws, const std::vector<std::pair<int, double>>& ambiguousBits, B* V_K)
+{
+    //   -  
+    ws.syndrome.reset(codeLength, graph.checkCount);
+    for (int v = 0; v < codeLength; v++) {
+        ws.syndrome.update(graph, v, estimateSendBit(ws, v) ? -1.0 : 1.0);
+    }
+
+    uint64_t candidateCount = uint64_t(1) << ambiguousBits.size();
+    uint64_t candidate = 0, bestCandidate = 0;
+    double metric = 0, bestMetric = 0;
+    int bestUnsatisfiedCount = ws.syndrome.unsatisfiedCount;
+    for (uint64_t i = 1; i < candidateCount && ws.syndrome.unsatisfiedCount != 0; i++) {
+        int bit = __builtin_ctzll(i);
+        candidate ^= uint64_t(1) << bit;
+        ws.syndrome.flip(graph, ambiguousBits[bit].first);
+        metric += ((candidate >> bit) & 1) ? std::abs(ambiguousBits[bit].second) : -std::abs(ambiguousBits[bit].second);
+        if (ws.syndrome.unsatisfiedCount < bestUnsatisfiedCount ||
+            (ws.syndrome.unsatisfiedCount == bestUnsatisfiedCount && metric < bestMetric)) {
+            bestCandidate = candidate;
+            bestMetric = metric;
+            bestUnsatisfiedCount = ws.syndrome.unsatisfiedCount;
+        }
+    }
+
+    //    ,     
+    for (size_t bit = 0; bit < ambiguousBits.size(); bit++) {
+        if (((candidate ^ bestCandidate) >> bit) & 1) ws.syndrome.flip(graph, ambiguousBits[bit].first);
+    }
+    for (size_t i = 0; i < informationBitIndexes.size(); i++) {
+        V_K[i] = (B)ws.syndrome.getDecision(informationBitIndexes[i]);
+    }
+}
+
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::listDecode(const R* Y_N, int listSize, B* V_K)
+{
+    if (listSize < 1) {
+        throw std::invalid_argument("List size must be positive");
+    }
+    executeMessagePassing(workspace, Y_N);
+
+    //  ,     (   0)
+    int ambiguousBitCount = std::min<int>({ (int)std::floor(std::log2(listSize)), (int)informationBitIndexes.size(), 63 });
+    selectAmbiguousBits(workspace, ambiguousBitCount);
+    selectBestCandidate(workspace, workspace.ambiguousBits, V_K);
+}
+
+//   [0, count)    -  |LLR|   ws.ambiguousBits
+// ( k      k),    -  
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::rankChaseCandidates(DecodingWorkspace& ws, int count) const
+{
+    ws.chaseCandidates.resize(count);
+    ws.chaseCandidates[0] = { 0.0, 0 };
+    for (int candidate = 1; candidate < count; candidate++) {
+        int bit = __builtin_ctz(candidate);
+        ws.chaseCandidates[candidate] = { ws.chaseCandidates[candidate & (candidate - 1)].first + std::abs(ws.ambiguousBits[bit].second), candidate };
+    }
+    std::sort(ws.chaseCandidates.begin(), ws.chaseCandidates.end());
+}
+
+//  : log2(listSize)        (LLR +-Inf)
+//  BP          ( -   rankChaseCandidates).
+//   ,       ,   
+//     .  -       
+// (      ),  -     
+// (  -  ),        
+template <typename B, typename R>
+void Decoder_LDPC<B,R>::chaseDecode(const R* Y_N, int listSize, B* V_K)
+{
+    if (listSize < 1 || listSize > maxChaseListSize) {
+        throw std::invalid_argument("Chase list size must be in [1, " + std::to_string(maxChaseListSize) + "]");
+    }
+    executeMessagePassing(workspace, Y_N);
+    estimateInformationBits(workspace, V_K);
+    if (isSatisfyAllChecks(workspace)) return;
+
+    int ambiguousBitCount = std::min<int>((int)std::floor(std::log2(listSize)), (int)informationBitIndexes.size());
+    if (ambiguousBitCount == 0) return;
+    selectAmbiguousBits(workspace, ambiguousBitCount);
+    rankChaseCandidates(workspace, 1 << ambiguousBitCount);
+
+    prepareWorkerWorkspaces();
+
+    //    this  ,  std::function     .
+    // running[w] -    w, cancelled[w] -   
+    const int workerCount = threadPool->getWorkerCount();
+    struct ChaseState {
+        std::mutex resultMutex;
+        int satisfiedRank = INT32_MAX;
+        int bestRank = -1;
+        int bestUnsatisfiedCount;
+        B* V_K;
+        std::vector<int> running;
+        std::vector<std::atomic<bool>> cancelled;
+    } state;
+    state.bestUnsatisfiedCount = workspace.syndrome.unsatisfiedCount;
+    state.V_K = V_K;
+    state.running.assign(workerCount, INT32_MAX);
+    state.cancelled = std::vector<std::atomic<bool>>(workerCount);
+    threadPool->parallelFor(1 << ambiguousBitCount, [this, &state](int worker, int rank) {
+        {
+            std::lock_guard<std::mutex> lock(state.resultMutex);
+            if (rank > state.satisfiedRank) return;
+            state.running[worker] = rank;
+            state.cancelled[worker].store(false, std::memory_order_relaxed);
+        }
+        const std::vector<std::pair<int, double>>& llrs = workspace.ambiguousBits;
+        int candidate = workspace.chaseCandidates[rank].second;
+        DecodingWorkspace& ws = workerWorkspaces[worker];
+        ws.variableNodes = workspace.variableNodes;
+        for (size_t bit = 0; bit < llrs.size(); bit++) {
+            ws.variableNodes[llrs[bit].first].setIsFrozen(true, (llrs[bit].second < 0) ^ ((candidate >> bit) & 1));
+        }
+        seedWorker(ws, -1 - candidate);
+        executeSchedule(ws, &state.cancelled[worker]);
+        {
+            std::lock_guard<std::mutex> lock(state.resultMutex);
+            state.running[worker] = INT32_MAX;
+            //        
+            bool better = ws.terminationReason != TerminationReason::Cancelled && (isSatisfyAllChecks(ws)
+                ? rank < state.satisfiedRank
+                : state.satisfiedRank == INT32_MAX && (ws.syndrome.unsatisfiedCount < state.bestUnsatisfiedCount ||
+                    (ws.syndrome.unsatisfiedCount == state.bestUnsatisfiedCount && rank < state.bestRank)));
+            if (better) {
+                state.bestUnsatisfiedCount = ws.syndrome.unsatisfiedCount;
+                state.bestRank = rank;
+                estimateInformationBits(ws, state.V_K);
+            }
+            if (better && isSatisfyAllChecks(ws)) {
+                state.satisfiedRank = rank;
+                for (size_t w = 0; w < state.running.size(); w++) {
+                    if (state.running[w] > rank) state.cancelled[w].store(true, std::memory_order_relaxed);
+                }
+            }
+        }
+        for (size_t bit = 0; bit < llrs.size(); bit++) {
+            ws.variableNodes[llrs[bit].first].setIsFrozen(false);
+        }
+        });
+}
+
+//         
+template <typename B, typename R>
+R Decoder_LDPC<B,R>::quantizeSoftOutput(double llr) const
+{
+    if (fixedPoint) {
+        return (R)std::round(std::clamp(llr, -(double)messageSaturation, (double)messageSaturation));
+    }
+    return (R)llr;
+}
+
+//     : N    LLR (setSoftOutput)  Y_N2.
+//       (Inf  )   .
+//    C2V   frame_id (   -  )    
 template <typename B, typename R>
 int Decoder_LDPC<B,R>::_decode_siso(const R *Y_N1, R *Y_N2, const size_t frame_id)
 {
-    //       LDPC
+    const bool extrinsic = softOutput == SoftOutput::Extrinsic;
+    if (interFrame) {
+        const size_t wave = frame_id / laneCount;
+        bool warm = warmStart && wave < warmLaneCheckToVariable.size() && !warmLaneCheckToVariable[wave].empty();
+        if (warm) {
+            laneCheckToVariable = warmLaneCheckToVariable[wave];
+        }
+        executeInterFrameMessagePassing(Y_N1, warm);
+
+        for (int v = 0; v < codeLength; v++) {
+            bool frozen = workspace.variableNodes[v].getIsFrozen();
+            for (int l = 0; l < laneCount; l++) {
+                double llr = (double)laneSoftOutputs[(size_t)l * codeLength + v];
+                if (extrinsic && !frozen) llr -= (double)laneChannelLLRs[v].v[l];
+                Y_N2[(size_t)l * codeLength + v] = quantizeSoftOutput(llr);
+            }
+        }
+
+        if (warmStart) {
+            if (warmLaneCheckToVariable.size() <= wave) warmLaneCheckToVariable.resize(wave + 1);
+            warmLaneCheckToVariable[wave] = laneCheckToVariable;
+        }
+        return 0;
+    }
+
+    for (int i = 0; i < codeLength; i++) {
+        workspace.variableNodes[i].setChannelLLR(Y_N1[i]);
+    }
+    bool warm = warmStart && frame_id < warmCheckToVariable.size() && !warmCheckToVariable[frame_id].empty();
+    if (warm) {
+        workspace.checkToVariable = warmCheckToVariable[frame_id];
+    }
+    executeSchedule(workspace, nullptr, warm);
+
+    for (int v = 0; v < codeLength; v++) {
+        double llr = marginalize(workspace, v);
+        if (extrinsic && !workspace.variableNodes[v].getIsFrozen()) llr -= (double)Y_N1[v];
+        Y_N2[v] = quantizeSoftOutput(llr);
+    }
+
+    if (warmStart) {
+        if (warmCheckToVariable.size() <= frame_id) warmCheckToVariable.resize(frame_id + 1);
+        warmCheckToVariable[frame_id] = workspace.checkToVariable;
+    }
     return 0;
 }
 
 template <typename B, typename R>
 int Decoder_LDPC<B,R>::_decode_siho(const R *Y_N, B *V_K, const size_t frame_id)
 {
-    std::vector<R> Y_N_vec(Y_N, Y_N + this->N);
-    auto decoded = decode(Y_N_vec);
-    std::copy(decoded.begin(), decoded.end(), V_K);
+    //    BP    ,     
+    // ( R)      
+    if (chaseListSize > 1) {
+        const int K = (int)informationBitIndexes.size();
+        for (int l = 0; l < (interFrame ? laneCount : 1); l++) {
+            chaseDecode(Y_N + (size_t)l * codeLength, chaseListSize, V_K + (size_t)l * K);
+        }
+        return 0;
+    }
+
+    if (interFrame) {
+        executeInterFrameMessagePassing(Y_N);
+        const int K = (int)informationBitIndexes.size();
+        for (int l = 0; l < laneCount; l++) {
+            for (int i = 0; i < K; i++) {
+                V_K[(size_t)l * K + i] = laneDecisions[(size_t)l * codeLength + informationBitIndexes[i]];
+            }
+        }
+        return 0;
+    }
+
+    decode(Y_N, V_K);
     return 0;
 }
 
 template <typename B, typename R>
 int Decoder_LDPC<B,R>::_decode_siho_cw(const R *Y_N, B *V_N, const size_t frame_id)
 {
-    std::vector<R> Y_N_vec(Y_N, Y_N + this->N);
-    executeMessagePassing(Y_N_vec);
+    if (interFrame) {
+        executeInterFrameMessagePassing(Y_N);
+        std::copy(laneDecisions.begin(), laneDecisions.end(), V_N);
+        return 0;
+    }
+
+    executeMessagePassing(workspace, Y_N);
     for (int i = 0; i < this->N; i++) {
-        V_N[i] = variableNodes[i].estimateSendBit();
+        V_N[i] = (B)estimateSendBit(workspace, i);
     }
     return 0;
 }
@@ -2,18 +2,65 @@
 #define DECODER_LDPC_HPP
 
 #include <vector>
-#include <map>
 #include <cmath>
 #include <random>
 #include <algorithm>
 #include <stdexcept>
+#include <cstdint>
+#include <type_traits>
+#include <limits>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <istream>
 
 #include "Module/Decoder/Decoder_SISO.hpp"
+#include "Thread_Pool.hpp"
+
+#if defined(__AVX512F__)
+#define DECODER_LDPC_SIMD_BYTES 64
+#elif defined(__AVX2__)
+#define DECODER_LDPC_SIMD_BYTES 32
+#else
+#define DECODER_LDPC_SIMD_BYTES 16
+#endif
 
 namespace aff3ct
 {
 	namespace module
 	{
+		enum class CheckNodeRule {
+			SumProduct,
+			MinSum,
+			NormalizedMinSum,
+			OffsetMinSum
+		};
+
+		enum class DecodingSchedule {
+			Flooding,
+			Layered
+		};
+
+		enum class SoftOutput {
+			APosteriori,
+			Extrinsic
+		};
+
+		enum class TerminationReason {
+			Converged,
+			IterationLimit,
+			Stagnation,
+			Plateau,
+			Oscillation,
+			Cancelled
+		};
+
+		struct StoppingCriteria {
+			int iterationLimit = 40;
+			int stagnationIterations = 0;
+			int plateauIterations = 0;
+			int oscillationIterations = 0;
+		};
 
 		template <typename B = int, typename R = float>
 		class Decoder_LDPC : public Decoder_SISO<B, R>
@@ -24,55 +71,262 @@ namespace aff3ct
 				int checkNodeIndex;
 			};
 
+			struct IndexArray {
+				const int* values = nullptr;
+				size_t count = 0;
+
+				const int* data() const { return values; }
+				size_t size() const { return count; }
+				const int* begin() const { return values; }
+				const int* end() const { return values + count; }
+				const int& operator[](size_t index) const { return values[index]; }
+			};
+
+			struct TannerGraph {
+				struct CacheHeader {
+					char magic[8];
+					int32_t variableCount;
+					int32_t checkCount;
+					int32_t edgeCount;
+					int32_t reserved;
+				};
+
+				int variableCount = 0;
+				int checkCount = 0;
+				IndexArray checkOffsets;
+				IndexArray edgeVariables;
+				IndexArray edgeChecks;
+				IndexArray variableOffsets;
+				IndexArray variableEdges;
+				std::shared_ptr<const void> storage;
+
+				int edgeCount() const { return (int)edgeVariables.size(); }
+				int maxCheckDegree() const;
+				TannerGraph withoutVariables(const std::vector<char>& isRemoved) const;
+				static size_t blockSize(int variableCount, int checkCount, int edgeCount);
+				static TannerGraph attach(const int* block, int variableCount, int checkCount, int edgeCount, std::shared_ptr<const void> storage);
+				static TannerGraph build(int variableCount, int checkCount, const std::vector<Edge>& edges);
+				static TannerGraph load(const std::string& path);
+				static std::vector<Edge> parseAlist(std::istream& in, int& variableCount, int& checkCount);
+				static std::vector<Edge> parseMatrixMarket(std::istream& in, int& variableCount, int& checkCount);
+				static bool saveCache(const TannerGraph& graph, const std::string& cachePath);
+				static TannerGraph mapCache(const std::string& cachePath);
+				static std::shared_ptr<const void> mapFile(const std::string& path, size_t& size);
+			};
+
+			struct SystematicEncoder {
+				int variableCount = 0;
+				int wordCount = 0;
+				std::vector<int> freeColumns;
+				std::vector<int> pivotColumns;
+				std::vector<uint64_t> pivotRows;
+				std::vector<int> triangularColumns;
+				std::vector<int> triangularOffsets;
+				std::vector<int> triangularInputs;
+
+				static int getBit(const uint64_t* words, int index) { return (words[index >> 6] >> (index & 63)) & 1; }
+				static void flipBit(uint64_t* words, int index) { words[index >> 6] ^= uint64_t(1) << (index & 63); }
+				static void setBit(uint64_t* words, int index, int bit) { words[index >> 6] |= uint64_t(bit) << (index & 63); }
+				int gap() const { return (int)pivotColumns.size(); }
+				int rank() const { return (int)(triangularColumns.size() + pivotColumns.size()); }
+				void encode(uint64_t* words) const;
+				static SystematicEncoder build(const TannerGraph& graph, int systematicColumns);
+				static SystematicEncoder triangulate(const TannerGraph& graph, int systematicColumns);
+			};
+
+			struct SyndromeTracker {
+				std::vector<uint64_t> hardDecisions;
+				std::vector<uint64_t> undecided;
+				std::vector<uint64_t> checkParities;
+				int unsatisfiedCount = 0;
+				int undecidedCount = 0;
+
+				void reset(int variableCount, int checkCount);
+				void update(const TannerGraph& graph, int variable, double llr);
+				void flip(const TannerGraph& graph, int variable);
+				int getDecision(int variable) const { return (hardDecisions[variable >> 6] >> (variable & 63)) & 1; }
+				bool isSatisfied() const { return unsatisfiedCount == 0 && undecidedCount == 0; }
+				uint64_t hashDecisions() const;
+			};
+
+			struct IterationMonitor {
+				static constexpr int historySize = 8;
+
+				uint64_t history[historySize] = {};
+				int historyCount = 0;
+				int stableIterations = 0;
+				int bestUnsatisfiedCount = 0;
+				int plateauIterations = 0;
+				int oscillatingIterations = 0;
+
+				void reset();
+				bool observe(uint64_t hash, int unsatisfiedCount, const StoppingCriteria& criteria, TerminationReason& reason);
+			};
+
 			class CheckNode {
-			private:
-				std::map<int, double> receivedMessage;
 			public:
-				double calcMessage(int to);
-				void receiveMessage(int from, double message);
-				void clear();
+				static double tanhHalf(double message);
+				static void calcSumProductMessages(const double* incoming, double* outgoing, int degree);
+				static void calcMinSumMessages(const double* incoming, double* outgoing, int degree, double scale, double offset);
 			};
 
 			class VariableNode {
 			private:
 				double channelLLR = 0.0;
-				std::map<int, double> receivedMessage;
 				bool isFrozen = false;
+				int frozenBit = 0;
 			public:
-				void setIsFrozen(bool frozen);
-				double calcInitialMessage();
-				double calcMessage(int to);
-				void receiveMessage(int from, double message);
-				double marginalize();
-				int estimateSendBit();
+				void setIsFrozen(bool frozen, int bit = 0);
+				bool getIsFrozen() const;
+				double calcInitialMessage() const;
+				double calcMessage(const double* checkToVariable, const int* edges, int degree, int to) const;
+				double marginalize(const double* checkToVariable, const int* edges, int degree) const;
+				int estimateSendBit(const double* checkToVariable, const int* edges, int degree, std::mt19937& generator) const;
 				void clear();
 				void setChannelLLR(double llr);
+				static int hardDecision(double llr, std::mt19937& generator);
+			};
+
+			struct alignas(64) DecodingWorkspace {
+				std::vector<VariableNode> variableNodes;
+				std::vector<double> checkToVariable;
+				std::vector<double> variableToCheck;
+				std::vector<double> aPosterioriLLRs;
+				std::vector<double> layerMessages;
+				SyndromeTracker syndrome;
+				int iterationCount = 0;
+				TerminationReason terminationReason = TerminationReason::IterationLimit;
+				IterationMonitor iterationMonitor;
+				std::mt19937 generator;
+				std::vector<std::pair<int, double>> ambiguousBits;
+				std::vector<std::pair<double, int>> chaseCandidates;
+			};
+
+			static constexpr bool fixedPoint = std::is_integral<R>::value;
+			using LaneValue = typename std::conditional<fixedPoint, R,
+				typename std::conditional<std::is_same<R, double>::value, double, float>::type>::type;
+			using AccumulatorValue = typename std::conditional<!fixedPoint, LaneValue,
+				typename std::conditional<sizeof(LaneValue) == 1, int16_t, int32_t>::type>::type;
+			static constexpr int laneCount = DECODER_LDPC_SIMD_BYTES / (int)sizeof(LaneValue);
+
+			typedef LaneValue LaneVector __attribute__((vector_size(DECODER_LDPC_SIMD_BYTES)));
+			typedef AccumulatorValue LaneAccumulator __attribute__((vector_size(laneCount * sizeof(AccumulatorValue))));
+			using LaneMask = decltype(LaneVector{} < LaneVector{});
+
+			struct Lanes {
+				LaneVector v;
+			};
+
+			struct LaneBits {
+				LaneMask v;
 			};
 
 			int codeLength;
-			std::vector<Edge> edges;
-			std::vector<int> informationBitIndexes;
-			std::vector<int> frozenBitIndexes;
-			std::vector<VariableNode> variableNodes;
-			std::vector<CheckNode> checkNodes;
-			const int decodeIteration = 40;
+			IndexArray informationBitIndexes;
+			IndexArray frozenBitIndexes;
+			std::shared_ptr<const std::vector<int>> bitIndexStorage;
+			std::shared_ptr<const SystematicEncoder> encoder;
+			std::vector<uint64_t> codewordWords;
+			TannerGraph graph;
+			DecodingWorkspace workspace;
+			std::vector<DecodingWorkspace> workerWorkspaces;
+			std::shared_ptr<tools::Thread_Pool> threadPool;
+			int threadCount = 0;
+			uint32_t seed = std::mt19937::default_seed;
+			static const int maxChaseListSize = 1 << 16;
+			int chaseListSize = 1;
+			StoppingCriteria stoppingCriteria;
+			CheckNodeRule checkNodeRule = CheckNodeRule::SumProduct;
+			double normalizationFactor = 0.75;
+			double offsetFactor = 0.5;
+			DecodingSchedule schedule = DecodingSchedule::Flooding;
+			const double layeredMessageLimit = 1e3;
+			bool interFrame = false;
+			SoftOutput softOutput = SoftOutput::APosteriori;
+			bool warmStart = false;
+			std::vector<std::vector<double>> warmCheckToVariable;
+			std::vector<std::vector<Lanes>> warmLaneCheckToVariable;
+			LaneValue messageSaturation = fixedPoint ? std::numeric_limits<LaneValue>::max() : std::numeric_limits<LaneValue>::infinity();
+			LaneValue channelSaturation = fixedPoint ? (LaneValue)(messageSaturation / 4) : messageSaturation;
+			int fractionalBits = fixedPoint ? (sizeof(LaneValue) == 1 ? 2 : 3) : 0;
+			std::vector<Lanes> laneChannelLLRs;
+			std::vector<Lanes> laneCheckToVariable;
+			std::vector<Lanes> laneVariableToCheck;
+			std::vector<Lanes> laneAPosterioriLLRs;
+			std::vector<Lanes> laneLayerMessages;
+			std::vector<double> laneScalarIncoming;
+			std::vector<double> laneScalarOutgoing;
+			std::vector<LaneBits> laneEstimates;
+			std::vector<B> laneDecisions;
+			std::vector<LaneValue> laneSoftOutputs;
+			std::vector<IterationMonitor> laneMonitors;
+			std::vector<TerminationReason> laneTerminationReasons;
+			std::vector<int> laneIterationCounts;
 
-			bool isSatisfyAllChecks();
-			void executeMessagePassing(const std::vector<double>& channelOutputs);
-			std::vector<int> selectBestCandidate(const std::vector<std::vector<int>>& candidates, const std::vector<double>& channelOutputs);
+			bool isSatisfyAllChecks(const DecodingWorkspace& ws) const;
+			void startIterations(DecodingWorkspace& ws) const;
+			bool isIterationFinal(DecodingWorkspace& ws, const std::atomic<bool>* cancel) const;
+			double marginalize(const DecodingWorkspace& ws, int variable) const;
+			int estimateSendBit(DecodingWorkspace& ws, int variable) const;
+			void estimateInformationBits(DecodingWorkspace& ws, B* V_K) const;
+			void selectAmbiguousBits(DecodingWorkspace& ws, int count) const;
+			void rankChaseCandidates(DecodingWorkspace& ws, int count) const;
+			void calcCheckMessages(const double* incoming, double* outgoing, int degree) const;
+			void executeMessagePassing(DecodingWorkspace& ws, const R* Y_N);
+			void prepareWorkerWorkspaces();
+			void seedWorker(DecodingWorkspace& ws, int worker) const;
+			void executeSchedule(DecodingWorkspace& ws, const std::atomic<bool>* cancel, bool warm = false);
+			void executeFloodingSchedule(DecodingWorkspace& ws, const std::atomic<bool>* cancel, bool warm);
+			void executeLayeredSchedule(DecodingWorkspace& ws, const std::atomic<bool>* cancel, bool warm);
+			static LaneMask isInfinite(const LaneVector& x);
+			LaneVector saturate(const LaneAccumulator& x) const;
+			LaneVector correctMagnitude(const LaneVector& magnitude) const;
+			void calcLaneCheckMessages(const Lanes* incoming, Lanes* outgoing, int degree);
+			void calcLaneMinSumMessages(const Lanes* incoming, Lanes* outgoing, int degree) const;
+			void calcLaneVariableMessages();
+			void calcLaneMarginals();
+			void latchLane(int lane);
+			void latchFinishedLanes(bool* finished);
+			void executeInterFrameMessagePassing(const R* Y_N, bool warm = false);
+			R quantizeSoftOutput(double llr) const;
+			void selectBestCandidate(DecodingWorkspace& ws, const std::vector<std::pair<int, double>>& ambiguousBits, B* V_K);
+
+			Decoder_LDPC(const int K, const int N, const std::vector<int>& frozen_bits, TannerGraph parityCheckGraph);
 
 		public:
 			Decoder_LDPC(const int K, const int N, const std::vector<int>& frozen_bits);
+			Decoder_LDPC(const int K, const int N, const std::vector<int>& frozen_bits, const std::string& parityCheckPath);
 			virtual ~Decoder_LDPC() = default;
 			virtual Decoder_LDPC<B, R>* clone() const;
 
+			void setCheckNodeRule(CheckNodeRule rule);
+			void setSchedule(DecodingSchedule decodingSchedule);
+			void setMinSumParameters(double alpha, double beta);
+			void setInterFrame(bool enabled);
+			void setFixedPointFormat(int messageBits, int channelBits, int fractionalBits);
+			void setChaseListSize(int listSize);
+			void setSoftOutput(SoftOutput output);
+			void setWarmStart(bool enabled);
+			void resetWarmStart();
+			void setThreadCount(int threadCount);
+			void setSeed(const uint32_t seed);
+			void encode(const B* U_K, B* X_N);
+			void setStoppingCriteria(const StoppingCriteria& criteria);
+			const StoppingCriteria& getStoppingCriteria() const;
+			TerminationReason getTerminationReason() const;
+			TerminationReason getTerminationReason(int frame) const;
+			int getIterationCount() const;
+			int getIterationCount(int frame) const;
+			static constexpr int getInterFrameLevel() { return laneCount; }
+
 		protected:
 			virtual int _decode_siso(const R* Y_N1, R* Y_N2, const size_t frame_id);
 			virtual int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
 			virtual int _decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id);
 
-			std::vector<int> decode(const std::vector<double>& channelOutputs);
-			std::vector<std::vector<int>> listDecode(const std::vector<double>& channelOutputs, int listSize);
+			void decode(const R* Y_N, B* V_K);
+			void listDecode(const R* Y_N, int listSize, B* V_K);
+			void chaseDecode(const R* Y_N, int listSize, B* V_K);
 			double getRate() const;
 			double getListRate(int listSize) const;
 			int getRealCodeLength() const;
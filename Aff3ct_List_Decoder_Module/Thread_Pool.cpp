@@ -0,0 +1,117 @@
+#include "Thread_Pool.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+// threadCount -    (0 -     )
+Thread_Pool::Thread_Pool(int threadCount)
+: ranges(new WorkRange[threadCount + 1])
+{
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back(&Thread_Pool::workerLoop, this, i);
+    }
+}
+
+Thread_Pool::~Thread_Pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto& t : threads) t.join();
+}
+
+int Thread_Pool::getWorkerCount() const
+{
+    return (int)threads.size() + 1;
+}
+
+//    [begin, end)    64-     CAS
+uint64_t Thread_Pool::packRange(uint32_t begin, uint32_t end)
+{
+    return (uint64_t(begin) << 32) | end;
+}
+
+bool Thread_Pool::takeOwn(int worker, int& index)
+{
+    std::atomic<uint64_t>& range = ranges[worker].range;
+    uint64_t current = range.load();
+    while (true) {
+        uint32_t begin = current >> 32, end = (uint32_t)current;
+        if (begin >= end) return false;
+        if (range.compare_exchange_weak(current, packRange(begin + 1, end))) {
+            index = begin;
+            return true;
+        }
+    }
+}
+
+//  :         
+bool Thread_Pool::steal(int worker, int& index)
+{
+    int workerCount = getWorkerCount();
+    for (int k = 1; k < workerCount; k++) {
+        std::atomic<uint64_t>& range = ranges[(worker + k) % workerCount].range;
+        uint64_t current = range.load();
+        while (true) {
+            uint32_t begin = current >> 32, end = (uint32_t)current;
+            if (begin >= end) break;
+            uint32_t middle = begin + (end - begin) / 2;
+            if (range.compare_exchange_weak(current, packRange(begin, middle))) {
+                ranges[worker].range.store(packRange(middle + 1, end));
+                index = middle;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Thread_Pool::runTasks(int worker)
+{
+    int index;
+    while (takeOwn(worker, index) || steal(worker, index)) {
+        (*task)(worker, index);
+    }
+}
+
+void Thread_Pool::workerLoop(int worker)
+{
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+        }
+        runTasks(worker);
+        std::lock_guard<std::mutex> lock(stateMutex);
+        if (--busyThreads == 0) doneCondition.notify_one();
+    }
+}
+
+//  function(worker, index)   index  [0, count)   ;
+//       ,   -    
+void Thread_Pool::parallelFor(int count, const std::function<void(int, int)>& function)
+{
+    std::lock_guard<std::mutex> submit(submitMutex);
+    int workerCount = getWorkerCount();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        task = &function;
+        for (int w = 0; w < workerCount; w++) {
+            ranges[w].range.store(packRange((uint32_t)(int64_t(count) * w / workerCount),
+                                            (uint32_t)(int64_t(count) * (w + 1) / workerCount)));
+        }
+        busyThreads = (int)threads.size();
+        generation++;
+    }
+    wakeCondition.notify_all();
+    runTasks(workerCount - 1);
+
+    std::unique_lock<std::mutex> lock(stateMutex);
+    doneCondition.wait(lock, [&] { return busyThreads == 0; });
+    task = nullptr;
+}
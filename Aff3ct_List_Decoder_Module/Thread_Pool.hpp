@@ -0,0 +1,53 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+#include <memory>
+
+namespace aff3ct
+{
+	namespace tools
+	{
+		class Thread_Pool
+		{
+		private:
+			struct alignas(64) WorkRange {
+				std::atomic<uint64_t> range{ 0 };
+			};
+
+			std::vector<std::thread> threads;
+			std::unique_ptr<WorkRange[]> ranges;
+			std::mutex stateMutex;
+			std::mutex submitMutex;
+			std::condition_variable wakeCondition;
+			std::condition_variable doneCondition;
+			const std::function<void(int, int)>* task = nullptr;
+			int busyThreads = 0;
+			uint64_t generation = 0;
+			bool stopping = false;
+
+			static uint64_t packRange(uint32_t begin, uint32_t end);
+			bool takeOwn(int worker, int& index);
+			bool steal(int worker, int& index);
+			void runTasks(int worker);
+			void workerLoop(int worker);
+
+		public:
+			explicit Thread_Pool(int threadCount);
+			Thread_Pool(const Thread_Pool&) = delete;
+			Thread_Pool& operator=(const Thread_Pool&) = delete;
+			~Thread_Pool();
+
+			int getWorkerCount() const;
+			void parallelFor(int count, const std::function<void(int, int)>& function);
+		};
+	}
+}
+
+#endif /* THREAD_POOL_HPP */
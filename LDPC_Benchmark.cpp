@@ -0,0 +1,555 @@
+//        (JSON Lines)
+/*
+ (    ):
+	g++ -std=c++17 -O3 -march=native -pthread LDPC_Benchmark.cpp -o ldpc_benchmark
+
+:
+	ldpc_benchmark --n 504,1008 --dv 3 --dc 6 --list 4,16 --ebn0 1.5,2.5 --schedule flooding,layered > baseline.jsonl
+
+1.  - PEG    (--seed),  -   BPSK  AWGN      :
+        .    .
+2.     (N, dv, dc, Eb/N0)     :
+   checkNode -      spa  nms (ns  );
+   variableNode - V2C   LLR   (ns  );
+   syndrome -     LLR     isSatisfied (ns  );
+   encode - LDPCCode::encode    (ns    ,  );
+   decode - LDPCCode::decode    (/, ns    =  / ( * E));
+   list - listDecode   --list (/     BP  ).
+     -  --batches   --repeat ,  decode  list -  --batches   .
+3.  decode  list      (operator new    )
+   ,   perf events (Linux),      ;    null.
+4.    -  JSON      .
+*/
+#include "LDPC_List_Decoder.cpp"
+
+#include <cstdio>
+#include <cstdlib>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+//    ( operator new )
+static atomic<long long> allocationCount{ 0 };
+
+void* operator new(size_t size) {
+	allocationCount.fetch_add(1, memory_order_relaxed);
+	if (void* pointer = malloc(size ? size : 1)) return pointer;
+	throw bad_alloc();
+}
+
+//  :  GCC  free   operator new   (-Wmismatched-new-delete)
+__attribute__((noinline)) void operator delete(void* pointer) noexcept {
+	free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+	operator delete(pointer);
+}
+
+//   perf   (Linux);     
+class PerfCounter {
+private:
+	int descriptor = -1;
+
+public:
+	enum class Event {
+		CacheReferences,
+		CacheMisses
+	};
+
+	explicit PerfCounter(Event event) {
+#ifdef __linux__
+		perf_event_attr attributes;
+		memset(&attributes, 0, sizeof(attributes));
+		attributes.size = sizeof(attributes);
+		attributes.type = PERF_TYPE_HARDWARE;
+		attributes.config = event == Event::CacheMisses ? PERF_COUNT_HW_CACHE_MISSES : PERF_COUNT_HW_CACHE_REFERENCES;
+		attributes.disabled = 1;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv = 1;
+		descriptor = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+#else
+		(void)event;
+#endif
+	}
+
+	PerfCounter(const PerfCounter&) = delete;
+	PerfCounter& operator=(const PerfCounter&) = delete;
+
+	~PerfCounter() {
+		if (descriptor >= 0) close(descriptor);
+	}
+
+	bool isAvailable() const {
+		return descriptor >= 0;
+	}
+
+	void start() {
+#ifdef __linux__
+		if (descriptor < 0) return;
+		ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+		ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+	}
+
+	//    start; -1 -  
+	long long stop() {
+		long long value = -1;
+#ifdef __linux__
+		if (descriptor < 0) return -1;
+		ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+		if (read(descriptor, &value, sizeof(value)) != sizeof(value)) value = -1;
+#endif
+		return value;
+	}
+};
+
+//  :  JSON,    
+class JsonRecord {
+private:
+	ostringstream out;
+	bool empty = true;
+
+	ostringstream& key(const string& name) {
+		out << (empty ? "{" : ", ") << "\"" << name << "\": ";
+		empty = false;
+		return out;
+	}
+
+public:
+	JsonRecord& add(const string& name, const string& value) {
+		key(name) << "\"" << value << "\"";
+		return *this;
+	}
+
+	JsonRecord& add(const string& name, long long value) {
+		key(name) << value;
+		return *this;
+	}
+
+	JsonRecord& add(const string& name, double value) {
+		if (isfinite(value)) key(name) << value;
+		else key(name) << "null";
+		return *this;
+	}
+
+	//     ; null,   
+	JsonRecord& addCounter(const string& name, long long value, double units) {
+		if (value < 0) key(name) << "null";
+		else key(name) << value / units;
+		return *this;
+	}
+
+	string str() const {
+		return out.str() + "}";
+	}
+};
+
+//   (  ,   )
+struct BenchmarkOptions {
+	vector<int> codeLengths = { 504, 1008 };
+	vector<int> variableNodeDegrees = { 3 };
+	vector<int> checkNodeDegrees = { 6 };
+	vector<int> listSizes = { 4, 16 };
+	vector<double> ebn0s = { 1.5, 2.5 };
+	vector<string> schedules = { "flooding", "layered" };
+	string rule = "nms"; //     decode  list
+	int frameCount = 200; //    decode  list
+	int repeatCount = 20; //     
+	int batchCount = 5; //   ( )
+	uint64_t seed = 1; //    
+
+	static BenchmarkOptions parse(int argc, char** argv) {
+		BenchmarkOptions options;
+		for (int i = 1; i < argc; i++) {
+			string name = argv[i];
+			if (i + 1 >= argc) {
+				throw invalid_argument("Missing value for " + name);
+			}
+			string value = argv[++i];
+			if (name == "--n") options.codeLengths = parseList<int>(value);
+			else if (name == "--dv") options.variableNodeDegrees = parseList<int>(value);
+			else if (name == "--dc") options.checkNodeDegrees = parseList<int>(value);
+			else if (name == "--list") options.listSizes = parseList<int>(value);
+			else if (name == "--ebn0") options.ebn0s = parseList<double>(value);
+			else if (name == "--schedule") options.schedules = parseList<string>(value);
+			else if (name == "--rule") options.rule = value;
+			else if (name == "--frames") options.frameCount = stoi(value);
+			else if (name == "--repeat") options.repeatCount = stoi(value);
+			else if (name == "--batches") options.batchCount = stoi(value);
+			else if (name == "--seed") options.seed = stoull(value);
+			else throw invalid_argument("Unknown option " + name);
+		}
+		if (options.frameCount < 1 || options.repeatCount < 1 || options.batchCount < 1) {
+			throw invalid_argument("Invalid benchmark options");
+		}
+		parseRule(options.rule);
+		for (const string& schedule : options.schedules) {
+			parseSchedule(schedule);
+		}
+		return options;
+	}
+
+	template <typename T>
+	static vector<T> parseList(const string& value) {
+		vector<T> values;
+		stringstream in(value);
+		string item;
+		while (getline(in, item, ',')) {
+			if (item.empty()) continue;
+			T parsed;
+			stringstream itemStream(item);
+			if (!(itemStream >> parsed)) {
+				throw invalid_argument("Invalid list value " + item);
+			}
+			values.push_back(parsed);
+		}
+		return values;
+	}
+
+	static CheckNodeRule parseRule(const string& value) {
+		if (value == "spa") return CheckNodeRule::SumProduct;
+		if (value == "ms") return CheckNodeRule::MinSum;
+		if (value == "nms") return CheckNodeRule::NormalizedMinSum;
+		if (value == "oms") return CheckNodeRule::OffsetMinSum;
+		throw invalid_argument("Unknown check node rule " + value);
+	}
+
+	static DecodingSchedule parseSchedule(const string& value) {
+		if (value == "flooding") return DecodingSchedule::Flooding;
+		if (value == "layered") return DecodingSchedule::Layered;
+		if (value == "residual") return DecodingSchedule::Residual;
+		throw invalid_argument("Unknown schedule " + value);
+	}
+};
+
+//  : ,   
+struct BenchmarkPoint {
+	int codeLength = 0;
+	int informationBitSize = 0;
+	int variableNodeDegree = 0;
+	int checkNodeDegree = 0;
+	double ebn0 = 0;
+	TannerGraph graph; //     (  PEG,    code)
+	vector<double> frames; // frameCount   LLR 
+};
+
+class Benchmark {
+private:
+	BenchmarkOptions options;
+	PerfCounter cacheReferences{ PerfCounter::Event::CacheReferences };
+	PerfCounter cacheMisses{ PerfCounter::Event::CacheMisses };
+	const double warmUpSeconds = 0.2; //      
+
+	static double seconds(chrono::steady_clock::time_point start) {
+		return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	}
+
+	//      (batchCount   repeatCount )
+	template <typename Kernel>
+	double measureKernel(Kernel&& kernel) const {
+		kernel();
+		vector<double> batches;
+		for (int b = 0; b < options.batchCount; b++) {
+			auto start = chrono::steady_clock::now();
+			for (int r = 0; r < options.repeatCount; r++) {
+				kernel();
+			}
+			batches.push_back(seconds(start) / options.repeatCount);
+		}
+		nth_element(batches.begin(), batches.begin() + batches.size() / 2, batches.end());
+		return batches[batches.size() / 2];
+	}
+
+	JsonRecord record(const BenchmarkPoint& point, const string& kernel) const {
+		JsonRecord json;
+		json.add("kernel", kernel)
+			.add("n", static_cast<long long>(point.codeLength))
+			.add("k", static_cast<long long>(point.informationBitSize))
+			.add("dv", static_cast<long long>(point.variableNodeDegree))
+			.add("dc", static_cast<long long>(point.checkNodeDegree))
+			.add("ebn0", point.ebn0);
+		return json;
+	}
+
+	static void emit(const JsonRecord& json) {
+		printf("%s\n", json.str().c_str());
+		fflush(stdout);
+	}
+
+	//   : BPSK +1, LLR = 2y / sigma^2
+	BenchmarkPoint createPoint(int codeLength, int variableNodeDegree, int checkNodeDegree, double ebn0) const {
+		BenchmarkPoint point;
+		point.codeLength = codeLength;
+		point.variableNodeDegree = variableNodeDegree;
+		point.checkNodeDegree = checkNodeDegree;
+		point.informationBitSize = codeLength - codeLength * variableNodeDegree / checkNodeDegree;
+		point.ebn0 = ebn0;
+		point.graph = TannerGraph::build(codeLength, codeLength * variableNodeDegree / checkNodeDegree,
+			ProgressiveEdgeGrowth::build(codeLength, variableNodeDegree, checkNodeDegree, options.seed));
+
+		double rate = static_cast<double>(point.informationBitSize) / codeLength;
+		double sigma = sqrt(1.0 / (2.0 * rate * pow(10.0, ebn0 / 10.0)));
+		mt19937_64 generator(options.seed);
+		normal_distribution<double> noise(0.0, sigma);
+		point.frames.resize(static_cast<size_t>(options.frameCount) * codeLength);
+		for (double& llr : point.frames) {
+			llr = 2.0 * (1.0 + noise(generator)) / (sigma * sigma);
+		}
+		return point;
+	}
+
+	LDPCCode createCode(const BenchmarkPoint& point, DecodingSchedule schedule) const {
+		LDPCCode code = LDPCCode::constructProgressiveEdgeGrowthCode(point.codeLength, point.informationBitSize,
+			point.variableNodeDegree, point.checkNodeDegree, options.seed);
+		code.setCheckNodeRule(BenchmarkOptions::parseRule(options.rule));
+		code.setSchedule(schedule);
+		return code;
+	}
+
+	//       : V2C  , C2V -  
+	void benchmarkNodes(const BenchmarkPoint& point) const {
+		const TannerGraph& graph = point.graph;
+		const int edgeCount = graph.edgeCount();
+		vector<VariableNode> variableNodes(point.codeLength);
+		for (int v = 0; v < point.codeLength; v++) {
+			variableNodes[v].setChannelLLR(point.frames[v]);
+		}
+		vector<double> variableToCheck(edgeCount), checkToVariable(edgeCount), marginals(point.codeLength);
+		for (int e = 0; e < edgeCount; e++) {
+			variableToCheck[e] = point.frames[graph.edgeVariables[e]];
+		}
+
+		const pair<const char*, CheckNodeRule> rules[] = { { "spa", CheckNodeRule::SumProduct }, { "nms", CheckNodeRule::NormalizedMinSum } };
+		for (const auto& rule : rules) {
+			double time = measureKernel([&] {
+				for (int c = 0; c < graph.checkCount; c++) {
+					int begin = graph.checkOffsets[c];
+					int degree = graph.checkOffsets[c + 1] - begin;
+					if (rule.second == CheckNodeRule::SumProduct) {
+						CheckNode::calcSumProductMessages(variableToCheck.data() + begin, checkToVariable.data() + begin, degree);
+					}
+					else {
+						CheckNode::calcMinSumMessages(variableToCheck.data() + begin, checkToVariable.data() + begin, degree, 0.75, 0.0);
+					}
+				}
+			});
+			emit(record(point, "checkNode").add("rule", string(rule.first)).add("nsPerEdge", time * 1e9 / edgeCount));
+		}
+
+		vector<double> variableToCheckOut(edgeCount);
+		double variableTime = measureKernel([&] {
+			for (int v = 0; v < point.codeLength; v++) {
+				const int* variableEdges = graph.variableEdges.data() + graph.variableOffsets[v];
+				int degree = graph.variableOffsets[v + 1] - graph.variableOffsets[v];
+				for (int k = 0; k < degree; k++) {
+					variableToCheckOut[variableEdges[k]] = variableNodes[v].calcMessage(checkToVariable.data(), variableEdges, degree, variableEdges[k]);
+				}
+				marginals[v] = variableNodes[v].marginalize(checkToVariable.data(), variableEdges, degree);
+			}
+		});
+		emit(record(point, "variableNode").add("nsPerEdge", variableTime * 1e9 / edgeCount));
+
+		//       LLR:     
+		SyndromeTracker syndrome;
+		syndrome.reset(point.codeLength, graph.checkCount);
+		long long flips = 0;
+		long long satisfiedPasses = 0;
+		for (int v = 0; v < point.codeLength; v++) {
+			flips += (point.frames[v] < 0) != (marginals[v] < 0);
+		}
+		double syndromeTime = measureKernel([&] {
+			for (int pass = 0; pass < 2; pass++) {
+				const double* llrs = pass ? marginals.data() : point.frames.data();
+				for (int v = 0; v < point.codeLength; v++) {
+					syndrome.update(graph, v, llrs[v]);
+				}
+				satisfiedPasses += syndrome.isSatisfied();
+			}
+		});
+		emit(record(point, "syndrome")
+			.add("nsPerVariable", syndromeTime * 1e9 / (2.0 * point.codeLength))
+			.add("flipsPerPass", flips)
+			.add("unsatisfiedChecks", static_cast<long long>(syndrome.unsatisfiedCount))
+			.add("satisfiedPasses", satisfiedPasses));
+	}
+
+	//  frameCount      ( -   )
+	void benchmarkEncoding(const BenchmarkPoint& point) const {
+		LDPCCode code = createCode(point, DecodingSchedule::Flooding);
+		mt19937_64 generator(options.seed);
+		vector<int> information(static_cast<size_t>(options.frameCount) * point.informationBitSize), codeword(point.codeLength);
+		for (int& bit : information) {
+			bit = generator() & 1;
+		}
+		double time = measureKernel([&] {
+			for (int frame = 0; frame < options.frameCount; frame++) {
+				code.encode(information.data() + static_cast<size_t>(frame) * point.informationBitSize, codeword.data());
+			}
+		});
+		emit(record(point, "encode")
+			.add("nsPerBit", time * 1e9 / (static_cast<double>(options.frameCount) * point.codeLength))
+			.add("framesPerSecond", options.frameCount / time)
+			.add("gap", static_cast<long long>(code.getEncoder().gap())));
+	}
+
+	//     :  -  ,  -   
+	struct FrameRun {
+		double seconds = 0;
+		double overheadSeconds = 0;
+		long long iterations = 0;
+		long long frameErrors = 0;
+		long long allocations = 0;
+		long long cacheReferences = -1;
+		long long cacheMisses = -1;
+	};
+
+	static double median(vector<double> values) {
+		nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+		return values[values.size() / 2];
+	}
+
+	// batchCount       decode (listSize = 0)  listDecode;
+	//   -   (,  )   warmUpSeconds.
+	//        decode,   listDecode  (
+	//   ):    BP    ,   
+	//     .    -     
+	FrameRun runFrames(LDPCCode& code, const BenchmarkPoint& point, int listSize) {
+		vector<int> decoded(point.informationBitSize);
+		auto frameLlrs = [&](int frame) {
+			return point.frames.data() + static_cast<size_t>(frame) * point.codeLength;
+		};
+		auto decodeFrame = [&](int frame) {
+			if (listSize > 0) code.listDecode(frameLlrs(frame), listSize, decoded.data());
+			else code.decode(frameLlrs(frame), decoded.data());
+		};
+		auto warmUpStart = chrono::steady_clock::now();
+		do {
+			for (int frame = 0; frame < options.frameCount; frame++) {
+				decodeFrame(frame);
+			}
+		} while (seconds(warmUpStart) < warmUpSeconds);
+
+		FrameRun run;
+		vector<double> batches, overheads;
+		long long allocations = 0, references = 0, misses = 0;
+		bool countersAvailable = true;
+		for (int b = 0; b < options.batchCount; b++) {
+			double measured = 0, baseline = 0;
+			for (int frame = 0; frame < options.frameCount; frame++) {
+				bool baselineFirst = listSize > 0 && frame % 2 == 0;
+				if (baselineFirst) {
+					auto start = chrono::steady_clock::now();
+					code.decode(frameLlrs(frame), decoded.data());
+					baseline += seconds(start);
+				}
+				long long allocationsBefore = allocationCount.load();
+				cacheReferences.start();
+				cacheMisses.start();
+				auto start = chrono::steady_clock::now();
+				decodeFrame(frame);
+				measured += seconds(start);
+				long long frameMisses = cacheMisses.stop();
+				long long frameReferences = cacheReferences.stop();
+				allocations += allocationCount.load() - allocationsBefore;
+				countersAvailable = countersAvailable && frameMisses >= 0 && frameReferences >= 0;
+				misses += frameMisses;
+				references += frameReferences;
+				if (b == 0) {
+					run.iterations += code.getIterationCount();
+					run.frameErrors += count(decoded.begin(), decoded.end(), 1) > 0;
+				}
+				if (listSize > 0 && !baselineFirst) {
+					auto start = chrono::steady_clock::now();
+					code.decode(frameLlrs(frame), decoded.data());
+					baseline += seconds(start);
+				}
+			}
+			batches.push_back(measured);
+			overheads.push_back(measured - baseline);
+		}
+		run.cacheMisses = countersAvailable ? misses / options.batchCount : -1;
+		run.cacheReferences = countersAvailable ? references / options.batchCount : -1;
+		run.allocations = allocations / options.batchCount;
+		run.seconds = median(batches);
+		run.overheadSeconds = median(overheads);
+		return run;
+	}
+
+	void addFrameMetrics(JsonRecord& json, const FrameRun& run) const {
+		json.add("framesPerSecond", options.frameCount / run.seconds)
+			.add("frameErrors", run.frameErrors)
+			.add("allocationsPerFrame", static_cast<double>(run.allocations) / options.frameCount)
+			.addCounter("cacheReferencesPerFrame", run.cacheReferences, options.frameCount)
+			.addCounter("cacheMissesPerFrame", run.cacheMisses, options.frameCount);
+	}
+
+	void benchmarkDecoding(const BenchmarkPoint& point) {
+		for (size_t s = 0; s < options.schedules.size(); s++) {
+			LDPCCode code = createCode(point, BenchmarkOptions::parseSchedule(options.schedules[s]));
+			FrameRun bp = runFrames(code, point, 0);
+			double edgeUpdates = static_cast<double>(bp.iterations) * point.graph.edgeCount();
+			JsonRecord json = record(point, "decode");
+			json.add("rule", options.rule)
+				.add("schedule", options.schedules[s])
+				.add("iterationsPerFrame", static_cast<double>(bp.iterations) / options.frameCount)
+				.add("nsPerEdgeUpdate", edgeUpdates > 0 ? bp.seconds * 1e9 / edgeUpdates : NAN);
+			addFrameMetrics(json, bp);
+			emit(json);
+
+			//  -   :   BP    
+			if (s != 0) continue;
+			for (int listSize : options.listSizes) {
+				FrameRun list = runFrames(code, point, listSize);
+				JsonRecord listJson = record(point, "list");
+				listJson.add("rule", options.rule)
+					.add("schedule", options.schedules[s])
+					.add("listSize", static_cast<long long>(listSize))
+					.add("listNsPerFrame", list.overheadSeconds * 1e9 / options.frameCount);
+				addFrameMetrics(listJson, list);
+				emit(listJson);
+			}
+		}
+	}
+
+public:
+	explicit Benchmark(const BenchmarkOptions& benchmarkOptions) : options(benchmarkOptions) {
+	}
+
+	void run() {
+		JsonRecord header;
+		header.add("kernel", string("environment"))
+			.add("seed", static_cast<long long>(options.seed))
+			.add("frames", static_cast<long long>(options.frameCount))
+			.add("repeat", static_cast<long long>(options.repeatCount))
+			.add("batches", static_cast<long long>(options.batchCount))
+			.add("perfCounters", static_cast<long long>(cacheMisses.isAvailable()));
+		emit(header);
+
+		for (int codeLength : options.codeLengths) {
+			for (int variableNodeDegree : options.variableNodeDegrees) {
+				for (int checkNodeDegree : options.checkNodeDegrees) {
+					for (double ebn0 : options.ebn0s) {
+						BenchmarkPoint point = createPoint(codeLength, variableNodeDegree, checkNodeDegree, ebn0);
+						benchmarkNodes(point);
+						benchmarkEncoding(point);
+						benchmarkDecoding(point);
+					}
+				}
+			}
+		}
+	}
+};
+
+int main(int argc, char** argv) {
+	try {
+		Benchmark(BenchmarkOptions::parse(argc, argv)).run();
+	}
+	catch (const exception& error) {
+		fprintf(stderr, "error: %s\n", error.what());
+		return 1;
+	}
+	return 0;
+}
@@ -1,247 +1,3568 @@
 #include <iostream>
 #include <vector>
-#include <map>
 #include <cmath>
 #include <random>
 #include <algorithm>
 #include <stdexcept>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <filesystem>
+#include <chrono>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
+//  :   -DLDPC_INSTRUMENTATION  DecoderStatistics
+//   LDPC_PROFILE(...)   ,    .
+#ifdef LDPC_INSTRUMENTATION
+#define LDPC_PROFILE(...) __VA_ARGS__
+#else
+#define LDPC_PROFILE(...)
+#endif
+
+//    
+enum class CheckNodeRule {
+	SumProduct, //   SPA (tanh/atanh)
+	MinSum, //     
+	NormalizedMinSum, // Min-sum    alpha
+	OffsetMinSum // Min-sum   beta
+};
+
+//   
+enum class DecodingSchedule {
+	Flooding, //   ,    
+	Layered, // :  LLR      
+	Residual //  (residual BP):       
+};
+
+//     , PEG-   
+enum class InformationPositions {
+	Prefix, //  K ,  -  N - M;   ,      H
+	EncoderFreeColumns //    -    H (  Prefix,   )
+};
+
+//    BP
+enum class TerminationReason {
+	Converged, //   
+	IterationLimit, //    (  residual BP)
+	Stagnation, //     ( residual BP -   )
+	Plateau, //     
+	Oscillation, //        
+	Cancelled //   (    )
+};
+
+const int terminationReasonCount = 6;
+
+inline const char* terminationReasonName(TerminationReason reason) {
+	static const char* names[terminationReasonCount] = { "converged", "iterationLimit", "stagnation", "plateau", "oscillation", "cancelled" };
+	return names[static_cast<int>(reason)];
+}
+
+//         (0 -  )
+/*
+1. stagnationIterations:       .
+2. plateauIterations:          .
+3. oscillationIterations:         
+   IterationMonitor::historySize   (   -  ).
+    :      .
+*/
+struct StoppingCriteria {
+	int iterationLimit = 40; //  
+	int stagnationIterations = 0;
+	int plateauIterations = 0;
+	int oscillationIterations = 0;
+};
 
 //         LDPC
+//    :   -     V2C (   )
 class CheckNode {
+public:
+	// tanh(m / 2)  ;    +-1 (   )
+	static double tanhHalf(double message)
+	{
+		if (isinf(message)) return message < 0 ? -1.0 : 1.0;
+		return tanh(message / 2);
+	}
+
+	//          SPA (tanh/atanh)     (O(dc))
+	/*
+	1.  : outgoing[k] =  tanh(m_j / 2)  j > k.
+	2.  :    k = 2 atanh(  j < k * outgoing[k]).
+	3. tanh       : 2dc  tanh  dc^2.
+	     ,       .
+	*/
+	static void calcSumProductMessages(const double* incoming, double* outgoing, int degree)
+	{
+		double suffix = 1.0;
+		for (int k = degree - 1; k >= 0; k--) {
+			outgoing[k] = suffix;
+			suffix *= tanhHalf(incoming[k]);
+		}
+
+		double prefix = 1.0;
+		for (int k = 0; k < degree; k++) {
+			double product = prefix * outgoing[k];
+			prefix *= tanhHalf(incoming[k]);
+			outgoing[k] = 2 * atanh(product);
+		}
+	}
+
+	//         min-sum    (O(dc))
+	/*
+	1.     (min1, min2),  min1   .
+	2.    k:  (   k)   (min2  k =  min1,  min1).
+	3.  : max(scale * min - offset, 0) (scale = alpha  , offset = beta  ).
+	*/
+	static void calcMinSumMessages(const double* incoming, double* outgoing, int degree, double scale, double offset)
+	{
+		double min1 = INFINITY, min2 = INFINITY;
+		int minIndex = -1;
+		bool negative = false;
+		for (int k = 0; k < degree; k++) {
+			double message = incoming[k];
+			double magnitude = fabs(message);
+			if (message < 0) negative = !negative;
+			if (magnitude < min1) {
+				min2 = min1;
+				min1 = magnitude;
+				minIndex = k;
+			}
+			else if (magnitude < min2) {
+				min2 = magnitude;
+			}
+		}
+
+		double corrected1 = max(scale * min1 - offset, 0.0);
+		double corrected2 = max(scale * min2 - offset, 0.0);
+		for (int k = 0; k < degree; k++) {
+			double magnitude = (k == minIndex) ? corrected2 : corrected1;
+			bool sign = negative != (incoming[k] < 0);
+			outgoing[k] = sign ? -magnitude : magnitude;
+		}
+	}
+};
+
+//        
+struct Edge {
+	int variableNodeIndex; //   ,   .
+	int checkNodeIndex; //    (),   .
+};
+
+//       (    )
+struct IndexArray {
+	const int* values = nullptr;
+	size_t count = 0;
+
+	const int* data() const { return values; }
+	size_t size() const { return count; }
+	const int* begin() const { return values; }
+	const int* end() const { return values + count; }
+	const int& operator[](size_t index) const { return values[index]; }
+};
+
+//       (CSR),      
+//     ;      -      C2V  V2C.
+//   -     int32 (  ),   storage:
+// ,   ,      .     .
+struct TannerGraph {
+	//   ,     
+	struct CacheHeader {
+		char magic[8]; // "LDPCCSR1"
+		int32_t variableCount;
+		int32_t checkCount;
+		int32_t edgeCount;
+		int32_t reserved;
+	};
+
+	int variableCount = 0; //   
+	int checkCount = 0; //   
+	IndexArray checkOffsets; //       ( checkCount + 1)
+	IndexArray edgeVariables; //      
+	IndexArray edgeChecks; //      
+	IndexArray variableOffsets; //        variableEdges ( variableCount + 1)
+	IndexArray variableEdges; //     (   )
+	shared_ptr<const void> storage; //   
+
+	int edgeCount() const {
+		return static_cast<int>(edgeVariables.size());
+	}
+
+	//     (    )
+	int maxCheckDegree() const {
+		int degree = 0;
+		for (int c = 0; c < checkCount; c++) {
+			degree = max(degree, checkOffsets[c + 1] - checkOffsets[c]);
+		}
+		return degree;
+	}
+
+	//  visit(check)     (SyndromeTracker   QuasiCyclicLayout)
+	template <typename Visit>
+	void forEachCheck(int variable, Visit visit) const {
+		for (int k = variableOffsets[variable]; k < variableOffsets[variable + 1]; k++) {
+			visit(edgeChecks[variableEdges[k]]);
+		}
+	}
+
+	//    ( int32)
+	static size_t blockSize(int variableCount, int checkCount, int edgeCount) {
+		return static_cast<size_t>(checkCount + 1) + static_cast<size_t>(variableCount + 1) + 3 * static_cast<size_t>(edgeCount);
+	}
+
+	//     
+	static TannerGraph attach(const int* block, int variableCount, int checkCount, int edgeCount, shared_ptr<const void> storage) {
+		TannerGraph graph;
+		graph.variableCount = variableCount;
+		graph.checkCount = checkCount;
+		graph.checkOffsets = IndexArray{ block, static_cast<size_t>(checkCount + 1) };
+		graph.edgeVariables = IndexArray{ graph.checkOffsets.end(), static_cast<size_t>(edgeCount) };
+		graph.edgeChecks = IndexArray{ graph.edgeVariables.end(), static_cast<size_t>(edgeCount) };
+		graph.variableOffsets = IndexArray{ graph.edgeChecks.end(), static_cast<size_t>(variableCount + 1) };
+		graph.variableEdges = IndexArray{ graph.variableOffsets.end(), static_cast<size_t>(edgeCount) };
+		graph.storage = move(storage);
+		return graph;
+	}
+
+	//  CSR-    (     )
+	static TannerGraph build(int variableCount, int checkCount, const vector<Edge>& edges) {
+		int edgeCount = static_cast<int>(edges.size());
+		auto block = make_shared<vector<int>>(blockSize(variableCount, checkCount, edgeCount), 0);
+		int* checkOffsets = block->data();
+		int* edgeVariables = checkOffsets + checkCount + 1;
+		int* edgeChecks = edgeVariables + edgeCount;
+		int* variableOffsets = edgeChecks + edgeCount;
+		int* variableEdges = variableOffsets + variableCount + 1;
+
+		for (const auto& edge : edges) {
+			checkOffsets[edge.checkNodeIndex + 1]++;
+			variableOffsets[edge.variableNodeIndex + 1]++;
+		}
+		for (int c = 0; c < checkCount; c++) {
+			checkOffsets[c + 1] += checkOffsets[c];
+		}
+		for (int v = 0; v < variableCount; v++) {
+			variableOffsets[v + 1] += variableOffsets[v];
+		}
+
+		vector<int> next(checkOffsets, checkOffsets + checkCount);
+		for (const auto& edge : edges) {
+			edgeVariables[next[edge.checkNodeIndex]++] = edge.variableNodeIndex;
+		}
+		for (int c = 0; c < checkCount; c++) {
+			fill(edgeChecks + checkOffsets[c], edgeChecks + checkOffsets[c + 1], c);
+		}
+
+		//    ,          
+		next.assign(variableOffsets, variableOffsets + variableCount);
+		for (int e = 0; e < edgeCount; e++) {
+			variableEdges[next[edgeVariables[e]]++] = e;
+		}
+		return attach(block->data(), variableCount, checkCount, edgeCount, block);
+	}
+
+	//      (    0),    
+	TannerGraph withoutVariables(const vector<char>& isRemoved) const {
+		vector<Edge> edges;
+		edges.reserve(edgeCount());
+		for (int c = 0; c < checkCount; c++) {
+			for (int e = checkOffsets[c]; e < checkOffsets[c + 1]; e++) {
+				if (!isRemoved[edgeVariables[e]]) edges.push_back(Edge{ edgeVariables[e], c });
+			}
+		}
+		return build(variableCount, checkCount, edges);
+	}
+
+	//      alist  Matrix Market (coordinate)
+	/*
+	1.      path + ".csr":     CSR   .
+	2.       (   ),       ;
+	        ,    .
+	3.   ,         :
+	         .      .
+	*/
+	static TannerGraph load(const string& path) {
+		string cachePath = path + ".csr";
+		error_code sourceError, cacheError;
+		auto sourceTime = filesystem::last_write_time(path, sourceError);
+		auto cacheTime = filesystem::last_write_time(cachePath, cacheError);
+		if (!cacheError && (sourceError || cacheTime >= sourceTime)) {
+			TannerGraph graph = mapCache(cachePath);
+			if (graph.storage) return graph;
+		}
+
+		ifstream in(path);
+		if (!in) {
+			throw runtime_error("Cannot open parity-check file: " + path);
+		}
+		int variableCount = 0, checkCount = 0;
+		vector<Edge> edges = (in.peek() == '%') ? parseMatrixMarket(in, variableCount, checkCount) : parseAlist(in, variableCount, checkCount);
+		TannerGraph graph = build(variableCount, checkCount, edges);
+		saveCache(graph, cachePath);
+		return graph;
+	}
+
+	//   alist (MacKay): N M,  ,    , 
+	//   ( 1)   ;   ,    
+	static vector<Edge> parseAlist(istream& in, int& variableCount, int& checkCount) {
+		int maxColumnWeight = 0, maxRowWeight = 0;
+		if (!(in >> variableCount >> checkCount >> maxColumnWeight >> maxRowWeight) || variableCount <= 0 || checkCount <= 0) {
+			throw invalid_argument("Invalid alist header");
+		}
+		vector<int> columnWeights(variableCount), rowWeights(checkCount);
+		for (int& weight : columnWeights) in >> weight;
+		for (int& weight : rowWeights) in >> weight;
+		if (!in) {
+			throw invalid_argument("Invalid alist weights");
+		}
+
+		vector<Edge> edges;
+		for (int v = 0; v < variableCount; v++) {
+			for (int k = 0; k < columnWeights[v];) {
+				int check = 0;
+				if (!(in >> check) || check < 0 || check > checkCount) {
+					throw invalid_argument("Invalid alist column " + to_string(v));
+				}
+				if (check == 0) continue;
+				edges.push_back(Edge{ v, check - 1 });
+				k++;
+			}
+		}
+		return edges;
+	}
+
+	//   Matrix Market: `%%MatrixMarket matrix coordinate ...`,  `M N nnz`,
+	//  nnz  `  []` ( 1);     
+	static vector<Edge> parseMatrixMarket(istream& in, int& variableCount, int& checkCount) {
+		string line;
+		getline(in, line);
+		if (line.find("coordinate") == string::npos) {
+			throw invalid_argument("Only coordinate Matrix Market files are supported");
+		}
+		while (getline(in, line) && (line.empty() || line[0] == '%'));
+		long long entryCount = 0;
+		if (!(istringstream(line) >> checkCount >> variableCount >> entryCount) || variableCount <= 0 || checkCount <= 0) {
+			throw invalid_argument("Invalid Matrix Market size line");
+		}
+
+		vector<Edge> edges;
+		edges.reserve(entryCount);
+		for (long long i = 0; i < entryCount; i++) {
+			int row = 0, column = 0;
+			double value = 1;
+			if (!getline(in, line)) {
+				throw invalid_argument("Unexpected end of Matrix Market file");
+			}
+			istringstream fields(line);
+			if (!(fields >> row >> column) || row < 1 || row > checkCount || column < 1 || column > variableCount) {
+				throw invalid_argument("Invalid Matrix Market entry: " + line);
+			}
+			fields >> value;
+			if (value != 0) edges.push_back(Edge{ column - 1, row - 1 });
+		}
+		return edges;
+	}
+
+	//    (   ); false,    
+	static bool saveCache(const TannerGraph& graph, const string& cachePath) {
+		CacheHeader header = { { 'L', 'D', 'P', 'C', 'C', 'S', 'R', '1' }, graph.variableCount, graph.checkCount, graph.edgeCount(), 0 };
+		string temporaryPath = cachePath + "." + to_string(random_device{}()) + ".tmp";
+		bool written;
+		{
+			ofstream out(temporaryPath, ios::binary);
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(reinterpret_cast<const char*>(graph.checkOffsets.data()),
+				blockSize(graph.variableCount, graph.checkCount, graph.edgeCount()) * sizeof(int32_t));
+			written = static_cast<bool>(out.flush());
+		}
+		error_code error;
+		if (written) filesystem::rename(temporaryPath, cachePath, error);
+		if (!written || error) {
+			filesystem::remove(temporaryPath, error);
+			return false;
+		}
+		return true;
+	}
+
+	//    ;    storage 
+	static TannerGraph mapCache(const string& cachePath) {
+		size_t size = 0;
+		shared_ptr<const void> mapping = mapFile(cachePath, size);
+		if (!mapping || size < sizeof(CacheHeader)) return TannerGraph();
+
+		const CacheHeader* header = static_cast<const CacheHeader*>(mapping.get());
+		if (memcmp(header->magic, "LDPCCSR1", 8) != 0 || header->variableCount < 0 || header->checkCount < 0 || header->edgeCount < 0 ||
+			size != sizeof(CacheHeader) + blockSize(header->variableCount, header->checkCount, header->edgeCount) * sizeof(int32_t)) {
+			return TannerGraph();
+		}
+		TannerGraph graph = attach(reinterpret_cast<const int*>(header + 1), header->variableCount, header->checkCount, header->edgeCount, mapping);
+		if (graph.checkOffsets[graph.checkCount] != header->edgeCount || graph.variableOffsets[graph.variableCount] != header->edgeCount) {
+			return TannerGraph();
+		}
+		return graph;
+	}
+
+	//        ( POSIX -  );    
+	static shared_ptr<const void> mapFile(const string& path, size_t& size) {
+#ifdef _WIN32
+		ifstream in(path, ios::binary | ios::ate);
+		if (!in) return nullptr;
+		size = static_cast<size_t>(in.tellg());
+		auto buffer = make_shared<vector<int32_t>>((size + sizeof(int32_t) - 1) / sizeof(int32_t));
+		in.seekg(0);
+		if (!in.read(reinterpret_cast<char*>(buffer->data()), size)) return nullptr;
+		return shared_ptr<const void>(buffer, buffer->data());
+#else
+		int descriptor = open(path.c_str(), O_RDONLY);
+		if (descriptor < 0) return nullptr;
+		struct stat info;
+		void* address = MAP_FAILED;
+		if (fstat(descriptor, &info) == 0 && info.st_size > 0) {
+			size = static_cast<size_t>(info.st_size);
+			address = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+		}
+		close(descriptor);
+		if (address == MAP_FAILED) return nullptr;
+		return shared_ptr<const void>(address, [size](const void* mapped) { munmap(const_cast<void*>(mapped), size); });
+#endif
+	}
+};
+
+//   5G NR (TS 38.212,  5.3.2-2  5.3.2-3): `{ i, j, V0, ..., V7 }` - , 
+//       iLS = 0..7 (QuasiCyclicBaseGraph::nrBaseGraph   )
+static const int16_t nrBaseGraph1Shifts[316][10] = {
+	{ 0, 0, 250, 307, 73, 223, 211, 294, 0, 135 },
+	{ 0, 1, 69, 19, 15, 16, 198, 118, 0, 227 },
+	{ 0, 2, 226, 50, 103, 94, 188, 167, 0, 126 },
+	{ 0, 3, 159, 369, 49, 91, 186, 330, 0, 134 },
+	{ 0, 5, 100, 181, 240, 74, 219, 207, 0, 84 },
+	{ 0, 6, 10, 216, 39, 10, 4, 165, 0, 83 },
+	{ 0, 9, 59, 317, 15, 0, 29, 243, 0, 53 },
+	{ 0, 10, 229, 288, 162, 205, 144, 250, 0, 225 },
+	{ 0, 11, 110, 109, 215, 216, 116, 1, 0, 205 },
+	{ 0, 12, 191, 17, 164, 21, 216, 339, 0, 128 },
+	{ 0, 13, 9, 357, 133, 215, 115, 201, 0, 75 },
+	{ 0, 15, 195, 215, 298, 14, 233, 53, 0, 135 },
+	{ 0, 16, 23, 106, 110, 70, 144, 347, 0, 217 },
+	{ 0, 18, 190, 242, 113, 141, 95, 304, 0, 220 },
+	{ 0, 19, 35, 180, 16, 198, 216, 167, 0, 90 },
+	{ 0, 20, 239, 330, 189, 104, 73, 47, 0, 105 },
+	{ 0, 21, 31, 346, 32, 81, 261, 188, 0, 137 },
+	{ 0, 22, 1, 1, 1, 1, 1, 1, 0, 1 },
+	{ 0, 23, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 1, 0, 2, 76, 303, 141, 179, 77, 22, 96 },
+	{ 1, 2, 239, 76, 294, 45, 162, 225, 11, 236 },
+	{ 1, 3, 117, 73, 27, 151, 223, 96, 124, 136 },
+	{ 1, 4, 124, 288, 261, 46, 256, 338, 0, 221 },
+	{ 1, 5, 71, 144, 161, 119, 160, 268, 10, 128 },
+	{ 1, 7, 222, 331, 133, 157, 76, 112, 0, 92 },
+	{ 1, 8, 104, 331, 4, 133, 202, 302, 0, 172 },
+	{ 1, 9, 173, 178, 80, 87, 117, 50, 2, 56 },
+	{ 1, 11, 220, 295, 129, 206, 109, 167, 16, 11 },
+	{ 1, 12, 102, 342, 300, 93, 15, 253, 60, 189 },
+	{ 1, 14, 109, 217, 76, 79, 72, 334, 0, 95 },
+	{ 1, 15, 132, 99, 266, 9, 152, 242, 6, 85 },
+	{ 1, 16, 142, 354, 72, 118, 158, 257, 30, 153 },
+	{ 1, 17, 155, 114, 83, 194, 147, 133, 0, 87 },
+	{ 1, 19, 255, 331, 260, 31, 156, 9, 168, 163 },
+	{ 1, 21, 28, 112, 301, 187, 119, 302, 31, 216 },
+	{ 1, 22, 0, 0, 0, 0, 0, 0, 105, 0 },
+	{ 1, 23, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 1, 24, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 2, 0, 106, 205, 68, 207, 258, 226, 132, 189 },
+	{ 2, 1, 111, 250, 7, 203, 167, 35, 37, 4 },
+	{ 2, 2, 185, 328, 80, 31, 220, 213, 21, 225 },
+	{ 2, 4, 63, 332, 280, 176, 133, 302, 180, 151 },
+	{ 2, 5, 117, 256, 38, 180, 243, 111, 4, 236 },
+	{ 2, 6, 93, 161, 227, 186, 202, 265, 149, 117 },
+	{ 2, 7, 229, 267, 202, 95, 218, 128, 48, 179 },
+	{ 2, 8, 177, 160, 200, 153, 63, 237, 38, 92 },
+	{ 2, 9, 95, 63, 71, 177, 0, 294, 122, 24 },
+	{ 2, 10, 39, 129, 106, 70, 3, 127, 195, 68 },
+	{ 2, 13, 142, 200, 295, 77, 74, 110, 155, 6 },
+	{ 2, 14, 225, 88, 283, 214, 229, 286, 28, 101 },
+	{ 2, 15, 225, 53, 301, 77, 0, 125, 85, 33 },
+	{ 2, 17, 245, 131, 184, 198, 216, 131, 47, 96 },
+	{ 2, 18, 205, 240, 246, 117, 269, 163, 179, 125 },
+	{ 2, 19, 251, 205, 230, 223, 200, 210, 42, 67 },
+	{ 2, 20, 117, 13, 276, 90, 234, 7, 66, 230 },
+	{ 2, 24, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 2, 25, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 3, 0, 121, 276, 220, 201, 187, 97, 4, 128 },
+	{ 3, 1, 89, 87, 208, 18, 145, 94, 6, 23 },
+	{ 3, 3, 84, 0, 30, 165, 166, 49, 33, 162 },
+	{ 3, 4, 20, 275, 197, 5, 108, 279, 113, 220 },
+	{ 3, 6, 150, 199, 61, 45, 82, 139, 49, 43 },
+	{ 3, 7, 131, 153, 175, 142, 132, 166, 21, 186 },
+	{ 3, 8, 243, 56, 79, 16, 197, 91, 6, 96 },
+	{ 3, 10, 136, 132, 281, 34, 41, 106, 151, 1 },
+	{ 3, 11, 86, 305, 303, 155, 162, 246, 83, 216 },
+	{ 3, 12, 246, 231, 253, 213, 57, 345, 154, 22 },
+	{ 3, 13, 219, 341, 164, 147, 36, 269, 87, 24 },
+	{ 3, 14, 211, 212, 53, 69, 115, 185, 5, 167 },
+	{ 3, 16, 240, 304, 44, 96, 242, 249, 92, 200 },
+	{ 3, 17, 76, 300, 28, 74, 165, 215, 173, 32 },
+	{ 3, 18, 244, 271, 77, 99, 0, 143, 120, 235 },
+	{ 3, 20, 144, 39, 319, 30, 113, 121, 2, 172 },
+	{ 3, 21, 12, 357, 68, 158, 108, 121, 142, 219 },
+	{ 3, 22, 1, 1, 1, 1, 1, 1, 0, 1 },
+	{ 3, 25, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 4, 0, 157, 332, 233, 170, 246, 42, 24, 64 },
+	{ 4, 1, 102, 181, 205, 10, 235, 256, 204, 211 },
+	{ 4, 26, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 5, 0, 205, 195, 83, 164, 261, 219, 185, 2 },
+	{ 5, 1, 236, 14, 292, 59, 181, 130, 100, 171 },
+	{ 5, 3, 194, 115, 50, 86, 72, 251, 24, 47 },
+	{ 5, 12, 231, 166, 318, 80, 283, 322, 65, 143 },
+	{ 5, 16, 28, 241, 201, 182, 254, 295, 207, 210 },
+	{ 5, 21, 123, 51, 267, 130, 79, 258, 161, 180 },
+	{ 5, 22, 115, 157, 279, 153, 144, 283, 72, 180 },
+	{ 5, 27, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 6, 0, 183, 278, 289, 158, 80, 294, 6, 199 },
+	{ 6, 6, 22, 257, 21, 119, 144, 73, 27, 22 },
+	{ 6, 10, 28, 1, 293, 113, 169, 330, 163, 23 },
+	{ 6, 11, 67, 351, 13, 21, 90, 99, 50, 100 },
+	{ 6, 13, 244, 92, 232, 63, 59, 172, 48, 92 },
+	{ 6, 17, 11, 253, 302, 51, 177, 150, 24, 207 },
+	{ 6, 18, 157, 18, 138, 136, 151, 284, 38, 52 },
+	{ 6, 20, 211, 225, 235, 116, 108, 305, 91, 13 },
+	{ 6, 28, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 7, 0, 220, 9, 12, 17, 169, 3, 145, 77 },
+	{ 7, 1, 44, 62, 88, 76, 189, 103, 88, 146 },
+	{ 7, 4, 159, 316, 207, 104, 154, 224, 112, 209 },
+	{ 7, 7, 31, 333, 50, 100, 184, 297, 153, 32 },
+	{ 7, 8, 167, 290, 25, 150, 104, 215, 159, 166 },
+	{ 7, 14, 104, 114, 76, 158, 164, 39, 76, 18 },
+	{ 7, 29, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 8, 0, 112, 307, 295, 33, 54, 348, 172, 181 },
+	{ 8, 1, 4, 179, 133, 95, 0, 75, 2, 105 },
+	{ 8, 3, 7, 165, 130, 4, 252, 22, 131, 141 },
+	{ 8, 12, 211, 18, 231, 217, 41, 312, 141, 223 },
+	{ 8, 16, 102, 39, 296, 204, 98, 224, 96, 177 },
+	{ 8, 19, 164, 224, 110, 39, 46, 17, 99, 145 },
+	{ 8, 21, 109, 368, 269, 58, 15, 59, 101, 199 },
+	{ 8, 22, 241, 67, 245, 44, 230, 314, 35, 153 },
+	{ 8, 24, 90, 170, 154, 201, 54, 244, 116, 38 },
+	{ 8, 30, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 9, 0, 103, 366, 189, 9, 162, 156, 6, 169 },
+	{ 9, 1, 182, 232, 244, 37, 159, 88, 10, 12 },
+	{ 9, 10, 109, 321, 36, 213, 93, 293, 145, 206 },
+	{ 9, 11, 21, 133, 286, 105, 134, 111, 53, 221 },
+	{ 9, 13, 142, 57, 151, 89, 45, 92, 201, 17 },
+	{ 9, 17, 14, 303, 267, 185, 132, 152, 4, 212 },
+	{ 9, 18, 61, 63, 135, 109, 76, 23, 164, 92 },
+	{ 9, 20, 216, 82, 209, 218, 209, 337, 173, 205 },
+	{ 9, 31, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 10, 1, 98, 101, 14, 82, 178, 175, 126, 116 },
+	{ 10, 2, 149, 339, 80, 165, 1, 253, 77, 151 },
+	{ 10, 4, 167, 274, 211, 174, 28, 27, 156, 70 },
+	{ 10, 7, 160, 111, 75, 19, 267, 231, 16, 230 },
+	{ 10, 8, 49, 383, 161, 194, 234, 49, 12, 115 },
+	{ 10, 14, 58, 354, 311, 103, 201, 267, 70, 84 },
+	{ 10, 32, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 11, 0, 77, 48, 16, 52, 55, 25, 184, 45 },
+	{ 11, 1, 41, 102, 147, 11, 23, 322, 194, 115 },
+	{ 11, 12, 83, 8, 290, 2, 274, 200, 123, 134 },
+	{ 11, 16, 182, 47, 289, 35, 181, 351, 16, 1 },
+	{ 11, 21, 78, 188, 177, 32, 273, 166, 104, 152 },
+	{ 11, 22, 252, 334, 43, 84, 39, 338, 109, 165 },
+	{ 11, 23, 22, 115, 280, 201, 26, 192, 124, 107 },
+	{ 11, 33, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 12, 0, 160, 77, 229, 142, 225, 123, 6, 186 },
+	{ 12, 1, 42, 186, 235, 175, 162, 217, 20, 215 },
+	{ 12, 10, 21, 174, 169, 136, 244, 142, 203, 124 },
+	{ 12, 11, 32, 232, 48, 3, 151, 110, 153, 180 },
+	{ 12, 13, 234, 50, 105, 28, 238, 176, 104, 98 },
+	{ 12, 18, 7, 74, 52, 182, 243, 76, 207, 80 },
+	{ 12, 34, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 13, 0, 177, 313, 39, 81, 231, 311, 52, 220 },
+	{ 13, 3, 248, 177, 302, 56, 0, 251, 147, 185 },
+	{ 13, 7, 151, 266, 303, 72, 216, 265, 1, 154 },
+	{ 13, 20, 185, 115, 160, 217, 47, 94, 16, 178 },
+	{ 13, 23, 62, 370, 37, 78, 36, 81, 46, 150 },
+	{ 13, 35, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 14, 0, 206, 142, 78, 14, 0, 22, 1, 124 },
+	{ 14, 12, 55, 248, 299, 175, 186, 322, 202, 144 },
+	{ 14, 15, 206, 137, 54, 211, 253, 277, 118, 182 },
+	{ 14, 16, 127, 89, 61, 191, 16, 156, 130, 95 },
+	{ 14, 17, 16, 347, 179, 51, 0, 66, 1, 72 },
+	{ 14, 21, 229, 12, 258, 43, 79, 78, 2, 76 },
+	{ 14, 36, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 15, 0, 40, 241, 229, 90, 170, 176, 173, 39 },
+	{ 15, 1, 96, 2, 290, 120, 0, 348, 6, 138 },
+	{ 15, 10, 65, 210, 60, 131, 183, 15, 81, 220 },
+	{ 15, 13, 63, 318, 130, 209, 108, 81, 182, 173 },
+	{ 15, 18, 75, 55, 184, 209, 68, 176, 53, 142 },
+	{ 15, 25, 179, 269, 51, 81, 64, 113, 46, 49 },
+	{ 15, 37, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 16, 1, 64, 13, 69, 154, 270, 190, 88, 78 },
+	{ 16, 3, 49, 338, 140, 164, 13, 293, 198, 152 },
+	{ 16, 11, 49, 57, 45, 43, 99, 332, 160, 84 },
+	{ 16, 20, 51, 289, 115, 189, 54, 331, 122, 5 },
+	{ 16, 22, 154, 57, 300, 101, 0, 114, 182, 205 },
+	{ 16, 38, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 17, 0, 7, 260, 257, 56, 153, 110, 91, 183 },
+	{ 17, 14, 164, 303, 147, 110, 137, 228, 184, 112 },
+	{ 17, 16, 59, 81, 128, 200, 0, 247, 30, 106 },
+	{ 17, 17, 1, 358, 51, 63, 0, 116, 3, 219 },
+	{ 17, 21, 144, 375, 228, 4, 162, 190, 155, 129 },
+	{ 17, 39, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 18, 1, 42, 130, 260, 199, 161, 47, 1, 183 },
+	{ 18, 12, 233, 163, 294, 110, 151, 286, 41, 215 },
+	{ 18, 13, 8, 280, 291, 200, 0, 246, 167, 180 },
+	{ 18, 18, 155, 132, 141, 143, 241, 181, 68, 143 },
+	{ 18, 19, 147, 4, 295, 186, 144, 73, 148, 14 },
+	{ 18, 40, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 19, 0, 60, 145, 64, 8, 0, 87, 12, 179 },
+	{ 19, 1, 73, 213, 181, 6, 0, 110, 6, 108 },
+	{ 19, 7, 72, 344, 101, 103, 118, 147, 166, 159 },
+	{ 19, 8, 127, 242, 270, 198, 144, 258, 184, 138 },
+	{ 19, 10, 224, 197, 41, 8, 0, 204, 191, 196 },
+	{ 19, 41, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 20, 0, 151, 187, 301, 105, 265, 89, 6, 77 },
+	{ 20, 3, 186, 206, 162, 210, 81, 65, 12, 187 },
+	{ 20, 9, 217, 264, 40, 121, 90, 155, 15, 203 },
+	{ 20, 11, 47, 341, 130, 214, 144, 244, 5, 167 },
+	{ 20, 22, 160, 59, 10, 183, 228, 30, 30, 130 },
+	{ 20, 42, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 21, 1, 249, 205, 79, 192, 64, 162, 6, 197 },
+	{ 21, 5, 121, 102, 175, 131, 46, 264, 86, 122 },
+	{ 21, 16, 109, 328, 132, 220, 266, 346, 96, 215 },
+	{ 21, 20, 131, 213, 283, 50, 9, 143, 42, 65 },
+	{ 21, 21, 171, 97, 103, 106, 18, 109, 199, 216 },
+	{ 21, 43, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 22, 0, 64, 30, 177, 53, 72, 280, 44, 25 },
+	{ 22, 12, 142, 11, 20, 0, 189, 157, 58, 47 },
+	{ 22, 13, 188, 233, 55, 3, 72, 236, 130, 126 },
+	{ 22, 17, 158, 22, 316, 148, 257, 113, 131, 178 },
+	{ 22, 44, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 23, 1, 156, 24, 249, 88, 180, 18, 45, 185 },
+	{ 23, 2, 147, 89, 50, 203, 0, 6, 18, 127 },
+	{ 23, 10, 170, 61, 133, 168, 0, 181, 132, 117 },
+	{ 23, 18, 152, 27, 105, 122, 165, 304, 100, 199 },
+	{ 23, 45, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 24, 0, 112, 298, 289, 49, 236, 38, 9, 32 },
+	{ 24, 3, 86, 158, 280, 157, 199, 170, 125, 178 },
+	{ 24, 4, 236, 235, 110, 64, 0, 249, 191, 2 },
+	{ 24, 11, 116, 339, 187, 193, 266, 288, 28, 156 },
+	{ 24, 22, 222, 234, 281, 124, 0, 194, 6, 58 },
+	{ 24, 46, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 25, 1, 23, 72, 172, 1, 205, 279, 4, 27 },
+	{ 25, 6, 136, 17, 295, 166, 0, 255, 74, 141 },
+	{ 25, 7, 116, 383, 96, 65, 0, 111, 16, 11 },
+	{ 25, 14, 182, 312, 46, 81, 183, 54, 28, 181 },
+	{ 25, 47, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 26, 0, 195, 71, 270, 107, 0, 325, 21, 163 },
+	{ 26, 2, 243, 81, 110, 176, 0, 326, 142, 131 },
+	{ 26, 4, 215, 76, 318, 212, 0, 226, 192, 169 },
+	{ 26, 15, 61, 136, 67, 127, 277, 99, 197, 98 },
+	{ 26, 48, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 27, 1, 25, 194, 210, 208, 45, 91, 98, 165 },
+	{ 27, 6, 104, 194, 29, 141, 36, 326, 140, 232 },
+	{ 27, 8, 194, 101, 304, 174, 72, 268, 22, 9 },
+	{ 27, 49, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 28, 0, 128, 222, 11, 146, 275, 102, 4, 32 },
+	{ 28, 4, 165, 19, 293, 153, 0, 1, 1, 43 },
+	{ 28, 19, 181, 244, 50, 217, 155, 40, 40, 200 },
+	{ 28, 21, 63, 274, 234, 114, 62, 167, 93, 205 },
+	{ 28, 50, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 29, 1, 86, 252, 27, 150, 0, 273, 92, 232 },
+	{ 29, 14, 236, 5, 308, 11, 180, 104, 136, 32 },
+	{ 29, 18, 84, 147, 117, 53, 0, 243, 106, 118 },
+	{ 29, 25, 6, 78, 29, 68, 42, 107, 6, 103 },
+	{ 29, 51, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 30, 0, 216, 159, 91, 34, 0, 171, 2, 170 },
+	{ 30, 10, 73, 229, 23, 130, 90, 16, 88, 199 },
+	{ 30, 13, 120, 260, 105, 210, 252, 95, 112, 26 },
+	{ 30, 24, 9, 90, 135, 123, 173, 212, 20, 105 },
+	{ 30, 52, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 31, 1, 95, 100, 222, 175, 144, 101, 4, 73 },
+	{ 31, 7, 177, 215, 308, 49, 144, 297, 49, 149 },
+	{ 31, 22, 172, 258, 66, 177, 166, 279, 125, 175 },
+	{ 31, 25, 61, 256, 162, 128, 19, 222, 194, 108 },
+	{ 31, 53, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 32, 0, 221, 102, 210, 192, 0, 351, 6, 103 },
+	{ 32, 12, 112, 201, 22, 209, 211, 265, 126, 110 },
+	{ 32, 14, 199, 175, 271, 58, 36, 338, 63, 151 },
+	{ 32, 24, 121, 287, 217, 30, 162, 83, 20, 211 },
+	{ 32, 54, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 33, 1, 2, 323, 170, 114, 0, 56, 10, 199 },
+	{ 33, 2, 187, 8, 20, 49, 0, 304, 30, 132 },
+	{ 33, 11, 41, 361, 140, 161, 76, 141, 6, 172 },
+	{ 33, 21, 211, 105, 33, 137, 18, 101, 92, 65 },
+	{ 33, 55, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 34, 0, 127, 230, 187, 82, 197, 60, 4, 161 },
+	{ 34, 7, 167, 148, 296, 186, 0, 320, 153, 237 },
+	{ 34, 15, 164, 202, 5, 68, 108, 112, 197, 142 },
+	{ 34, 17, 159, 312, 44, 150, 0, 54, 155, 180 },
+	{ 34, 56, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 35, 1, 161, 320, 207, 192, 199, 100, 4, 231 },
+	{ 35, 6, 197, 335, 158, 173, 278, 210, 45, 174 },
+	{ 35, 12, 207, 2, 55, 26, 0, 195, 168, 145 },
+	{ 35, 22, 103, 266, 285, 187, 205, 268, 185, 100 },
+	{ 35, 57, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 36, 0, 37, 210, 259, 222, 216, 135, 6, 11 },
+	{ 36, 14, 105, 313, 179, 157, 16, 15, 200, 207 },
+	{ 36, 15, 51, 297, 178, 0, 0, 35, 177, 42 },
+	{ 36, 18, 120, 21, 160, 6, 0, 188, 43, 100 },
+	{ 36, 58, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 37, 1, 198, 269, 298, 81, 72, 319, 82, 59 },
+	{ 37, 13, 220, 82, 15, 195, 144, 236, 2, 204 },
+	{ 37, 23, 122, 115, 115, 138, 0, 85, 135, 161 },
+	{ 37, 59, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 38, 0, 167, 185, 151, 123, 190, 164, 91, 121 },
+	{ 38, 9, 151, 177, 179, 90, 0, 196, 64, 90 },
+	{ 38, 10, 157, 289, 64, 73, 0, 209, 198, 26 },
+	{ 38, 12, 163, 214, 181, 10, 0, 246, 100, 140 },
+	{ 38, 60, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 39, 1, 173, 258, 102, 12, 153, 236, 4, 115 },
+	{ 39, 3, 139, 93, 77, 77, 0, 264, 28, 188 },
+	{ 39, 7, 149, 346, 192, 49, 165, 37, 109, 168 },
+	{ 39, 19, 0, 297, 208, 114, 117, 272, 188, 52 },
+	{ 39, 61, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 40, 0, 157, 175, 32, 67, 216, 304, 10, 4 },
+	{ 40, 8, 137, 37, 80, 45, 144, 237, 84, 103 },
+	{ 40, 17, 149, 312, 197, 96, 2, 135, 12, 30 },
+	{ 40, 62, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 41, 1, 167, 52, 154, 23, 0, 123, 2, 53 },
+	{ 41, 3, 173, 314, 47, 215, 0, 77, 75, 189 },
+	{ 41, 9, 139, 139, 124, 60, 0, 25, 142, 215 },
+	{ 41, 18, 151, 288, 207, 167, 183, 272, 128, 24 },
+	{ 41, 63, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 42, 0, 149, 113, 226, 114, 27, 288, 163, 222 },
+	{ 42, 4, 157, 14, 65, 91, 0, 83, 10, 170 },
+	{ 42, 24, 137, 218, 126, 78, 35, 17, 162, 71 },
+	{ 42, 64, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 43, 1, 151, 113, 228, 206, 52, 210, 1, 22 },
+	{ 43, 16, 163, 132, 69, 22, 243, 3, 163, 127 },
+	{ 43, 18, 173, 114, 176, 134, 0, 53, 99, 49 },
+	{ 43, 25, 139, 168, 102, 161, 270, 167, 98, 125 },
+	{ 43, 65, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 44, 0, 139, 80, 234, 84, 18, 79, 4, 191 },
+	{ 44, 7, 157, 78, 227, 4, 0, 244, 6, 211 },
+	{ 44, 9, 163, 163, 259, 9, 0, 293, 142, 187 },
+	{ 44, 22, 173, 274, 260, 12, 57, 272, 3, 148 },
+	{ 44, 66, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 45, 1, 149, 135, 101, 184, 168, 82, 181, 177 },
+	{ 45, 6, 151, 149, 228, 121, 0, 67, 45, 114 },
+	{ 45, 10, 167, 15, 126, 29, 144, 235, 153, 93 },
+	{ 45, 67, 0, 0, 0, 0, 0, 0, 0, 0 },
+};
+
+static const int16_t nrBaseGraph2Shifts[197][10] = {
+	{ 0, 0, 9, 174, 0, 72, 3, 156, 143, 145 },
+	{ 0, 1, 117, 97, 0, 110, 26, 143, 19, 131 },
+	{ 0, 2, 204, 166, 0, 23, 53, 14, 176, 71 },
+	{ 0, 3, 26, 66, 0, 181, 35, 3, 165, 21 },
+	{ 0, 6, 189, 71, 0, 95, 115, 40, 196, 23 },
+	{ 0, 9, 205, 172, 0, 8, 127, 123, 13, 112 },
+	{ 0, 10, 0, 0, 0, 1, 0, 0, 0, 1 },
+	{ 0, 11, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 1, 0, 167, 27, 137, 53, 19, 17, 18, 142 },
+	{ 1, 3, 166, 36, 124, 156, 94, 65, 27, 174 },
+	{ 1, 4, 253, 48, 0, 115, 104, 63, 3, 183 },
+	{ 1, 5, 125, 92, 0, 156, 66, 1, 102, 27 },
+	{ 1, 6, 226, 31, 88, 115, 84, 55, 185, 96 },
+	{ 1, 7, 156, 187, 0, 200, 98, 37, 17, 23 },
+	{ 1, 8, 224, 185, 0, 29, 69, 171, 14, 9 },
+	{ 1, 9, 252, 3, 55, 31, 50, 133, 180, 167 },
+	{ 1, 11, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 1, 12, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 2, 0, 81, 25, 20, 152, 95, 98, 126, 74 },
+	{ 2, 1, 114, 114, 94, 131, 106, 168, 163, 31 },
+	{ 2, 3, 44, 117, 99, 46, 92, 107, 47, 3 },
+	{ 2, 4, 52, 110, 9, 191, 110, 82, 183, 53 },
+	{ 2, 8, 240, 114, 108, 91, 111, 142, 132, 155 },
+	{ 2, 10, 1, 1, 1, 0, 1, 1, 1, 0 },
+	{ 2, 12, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 2, 13, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 3, 1, 8, 136, 38, 185, 120, 53, 36, 239 },
+	{ 3, 2, 58, 175, 15, 6, 121, 174, 48, 171 },
+	{ 3, 4, 158, 113, 102, 36, 22, 174, 18, 95 },
+	{ 3, 5, 104, 72, 146, 124, 4, 127, 111, 110 },
+	{ 3, 6, 209, 123, 12, 124, 73, 17, 203, 159 },
+	{ 3, 7, 54, 118, 57, 110, 49, 89, 3, 199 },
+	{ 3, 8, 18, 28, 53, 156, 128, 17, 191, 43 },
+	{ 3, 9, 128, 186, 46, 133, 79, 105, 160, 75 },
+	{ 3, 10, 0, 0, 0, 1, 0, 0, 0, 1 },
+	{ 3, 13, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 4, 0, 179, 72, 0, 200, 42, 86, 43, 29 },
+	{ 4, 1, 214, 74, 136, 16, 24, 67, 27, 140 },
+	{ 4, 11, 71, 29, 157, 101, 51, 83, 117, 180 },
+	{ 4, 14, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 5, 0, 231, 10, 0, 185, 40, 79, 136, 121 },
+	{ 5, 1, 41, 44, 131, 138, 140, 84, 49, 41 },
+	{ 5, 5, 194, 121, 142, 170, 84, 35, 36, 169 },
+	{ 5, 7, 159, 80, 141, 219, 137, 103, 132, 88 },
+	{ 5, 11, 103, 48, 64, 193, 71, 60, 62, 207 },
+	{ 5, 15, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 6, 0, 155, 129, 0, 123, 109, 47, 7, 137 },
+	{ 6, 5, 228, 92, 124, 55, 87, 154, 34, 72 },
+	{ 6, 7, 45, 100, 99, 31, 107, 10, 198, 172 },
+	{ 6, 9, 28, 49, 45, 222, 133, 155, 168, 124 },
+	{ 6, 11, 158, 184, 148, 209, 139, 29, 12, 56 },
+	{ 6, 16, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 7, 1, 129, 80, 0, 103, 97, 48, 163, 86 },
+	{ 7, 5, 147, 186, 45, 13, 135, 125, 78, 186 },
+	{ 7, 7, 140, 16, 148, 105, 35, 24, 143, 87 },
+	{ 7, 11, 3, 102, 96, 150, 108, 47, 107, 172 },
+	{ 7, 13, 116, 143, 78, 181, 65, 55, 58, 154 },
+	{ 7, 17, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 8, 0, 142, 118, 0, 147, 70, 53, 101, 176 },
+	{ 8, 1, 94, 70, 65, 43, 69, 31, 177, 169 },
+	{ 8, 12, 230, 152, 87, 152, 88, 161, 22, 225 },
+	{ 8, 18, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 9, 1, 203, 28, 0, 2, 97, 104, 186, 167 },
+	{ 9, 8, 205, 132, 97, 30, 40, 142, 27, 238 },
+	{ 9, 10, 61, 185, 51, 184, 24, 99, 205, 48 },
+	{ 9, 11, 247, 178, 85, 83, 49, 64, 81, 68 },
+	{ 9, 19, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 10, 0, 11, 59, 0, 174, 46, 111, 125, 38 },
+	{ 10, 1, 185, 104, 17, 150, 41, 25, 60, 217 },
+	{ 10, 6, 0, 22, 156, 8, 101, 174, 177, 208 },
+	{ 10, 7, 117, 52, 20, 56, 96, 23, 51, 232 },
+	{ 10, 20, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 11, 0, 11, 32, 0, 99, 28, 91, 39, 178 },
+	{ 11, 7, 236, 92, 7, 138, 30, 175, 29, 214 },
+	{ 11, 9, 210, 174, 4, 110, 116, 24, 35, 168 },
+	{ 11, 13, 56, 154, 2, 99, 64, 141, 8, 51 },
+	{ 11, 21, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 12, 1, 63, 39, 0, 46, 33, 122, 18, 124 },
+	{ 12, 3, 111, 93, 113, 217, 122, 11, 155, 122 },
+	{ 12, 11, 14, 11, 48, 109, 131, 4, 49, 72 },
+	{ 12, 22, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 13, 0, 83, 49, 0, 37, 76, 29, 32, 48 },
+	{ 13, 1, 2, 125, 112, 113, 37, 91, 53, 57 },
+	{ 13, 8, 38, 35, 102, 143, 62, 27, 95, 167 },
+	{ 13, 13, 222, 166, 26, 140, 47, 127, 186, 219 },
+	{ 13, 23, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 14, 1, 115, 19, 0, 36, 143, 11, 91, 82 },
+	{ 14, 6, 145, 118, 138, 95, 51, 145, 20, 232 },
+	{ 14, 11, 3, 21, 57, 40, 130, 8, 52, 204 },
+	{ 14, 13, 232, 163, 27, 116, 97, 166, 109, 162 },
+	{ 14, 24, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 15, 0, 51, 68, 0, 116, 139, 137, 174, 38 },
+	{ 15, 10, 175, 63, 73, 200, 96, 103, 108, 217 },
+	{ 15, 11, 213, 81, 99, 110, 128, 40, 102, 157 },
+	{ 15, 25, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 16, 1, 203, 87, 0, 75, 48, 78, 125, 170 },
+	{ 16, 9, 142, 177, 79, 158, 9, 158, 31, 23 },
+	{ 16, 11, 8, 135, 111, 134, 28, 17, 54, 175 },
+	{ 16, 12, 242, 64, 143, 97, 8, 165, 176, 202 },
+	{ 16, 26, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 17, 1, 254, 158, 0, 48, 120, 134, 57, 196 },
+	{ 17, 5, 124, 23, 24, 132, 43, 23, 201, 173 },
+	{ 17, 11, 114, 9, 109, 206, 65, 62, 142, 195 },
+	{ 17, 12, 64, 6, 18, 2, 42, 163, 35, 218 },
+	{ 17, 27, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 18, 0, 220, 186, 0, 68, 17, 173, 129, 128 },
+	{ 18, 6, 194, 6, 18, 16, 106, 31, 203, 211 },
+	{ 18, 7, 50, 46, 86, 156, 142, 22, 140, 210 },
+	{ 18, 28, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 19, 0, 87, 58, 0, 35, 79, 13, 110, 39 },
+	{ 19, 1, 20, 42, 158, 138, 28, 135, 124, 84 },
+	{ 19, 10, 185, 156, 154, 86, 41, 145, 52, 88 },
+	{ 19, 29, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 20, 1, 26, 76, 0, 6, 2, 128, 196, 117 },
+	{ 20, 4, 105, 61, 148, 20, 103, 52, 35, 227 },
+	{ 20, 11, 29, 153, 104, 141, 78, 173, 114, 6 },
+	{ 20, 30, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 21, 0, 76, 157, 0, 80, 91, 156, 10, 238 },
+	{ 21, 8, 42, 175, 17, 43, 75, 166, 122, 13 },
+	{ 21, 13, 210, 67, 33, 81, 81, 40, 23, 11 },
+	{ 21, 31, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 22, 1, 222, 20, 0, 49, 54, 18, 202, 195 },
+	{ 22, 2, 63, 52, 4, 1, 132, 163, 126, 44 },
+	{ 22, 32, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 23, 0, 23, 106, 0, 156, 68, 110, 52, 5 },
+	{ 23, 3, 235, 86, 75, 54, 115, 132, 170, 94 },
+	{ 23, 5, 238, 95, 158, 134, 56, 150, 13, 111 },
+	{ 23, 33, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 24, 1, 46, 182, 0, 153, 30, 113, 113, 81 },
+	{ 24, 2, 139, 153, 69, 88, 42, 108, 161, 19 },
+	{ 24, 9, 8, 64, 87, 63, 101, 61, 88, 130 },
+	{ 24, 34, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 25, 0, 228, 45, 0, 211, 128, 72, 197, 66 },
+	{ 25, 5, 156, 21, 65, 94, 63, 136, 194, 95 },
+	{ 25, 35, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 26, 2, 29, 67, 0, 90, 142, 36, 164, 146 },
+	{ 26, 7, 143, 137, 100, 6, 28, 38, 172, 66 },
+	{ 26, 12, 160, 55, 13, 221, 100, 53, 49, 190 },
+	{ 26, 13, 122, 85, 7, 6, 133, 145, 161, 86 },
+	{ 26, 36, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 27, 0, 8, 103, 0, 27, 13, 42, 168, 64 },
+	{ 27, 6, 151, 50, 32, 118, 10, 104, 193, 181 },
+	{ 27, 37, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 28, 1, 98, 70, 0, 216, 106, 64, 14, 7 },
+	{ 28, 2, 101, 111, 126, 212, 77, 24, 186, 144 },
+	{ 28, 5, 135, 168, 110, 193, 43, 149, 46, 16 },
+	{ 28, 38, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 29, 0, 18, 110, 0, 108, 133, 139, 50, 25 },
+	{ 29, 4, 28, 17, 154, 61, 25, 161, 27, 57 },
+	{ 29, 39, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 30, 2, 71, 120, 0, 106, 87, 84, 70, 37 },
+	{ 30, 5, 240, 154, 35, 44, 56, 173, 17, 139 },
+	{ 30, 7, 9, 52, 51, 185, 104, 93, 50, 221 },
+	{ 30, 9, 84, 56, 134, 176, 70, 29, 6, 17 },
+	{ 30, 40, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 31, 1, 106, 3, 0, 147, 80, 117, 115, 201 },
+	{ 31, 13, 1, 170, 20, 182, 139, 148, 189, 46 },
+	{ 31, 41, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 32, 0, 242, 84, 0, 108, 32, 116, 110, 179 },
+	{ 32, 5, 44, 8, 20, 21, 89, 73, 0, 14 },
+	{ 32, 12, 166, 17, 122, 110, 71, 142, 163, 116 },
+	{ 32, 42, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 33, 2, 132, 165, 0, 71, 135, 105, 163, 46 },
+	{ 33, 7, 164, 179, 88, 12, 6, 137, 173, 2 },
+	{ 33, 10, 235, 124, 13, 109, 2, 29, 179, 106 },
+	{ 33, 43, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 34, 0, 147, 173, 0, 29, 37, 11, 197, 184 },
+	{ 34, 12, 85, 177, 19, 201, 25, 41, 191, 135 },
+	{ 34, 13, 36, 12, 78, 69, 114, 162, 193, 141 },
+	{ 34, 44, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 35, 1, 57, 77, 0, 91, 60, 126, 157, 85 },
+	{ 35, 5, 40, 184, 157, 165, 137, 152, 167, 225 },
+	{ 35, 11, 63, 18, 6, 55, 93, 172, 181, 175 },
+	{ 35, 45, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 36, 0, 140, 25, 0, 1, 121, 73, 197, 178 },
+	{ 36, 2, 38, 151, 63, 175, 129, 154, 167, 112 },
+	{ 36, 7, 154, 170, 82, 83, 26, 129, 179, 106 },
+	{ 36, 46, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 37, 10, 219, 37, 0, 40, 97, 167, 181, 154 },
+	{ 37, 13, 151, 31, 144, 12, 56, 38, 193, 114 },
+	{ 37, 47, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 38, 1, 31, 84, 0, 37, 1, 112, 157, 42 },
+	{ 38, 5, 66, 151, 93, 97, 70, 7, 173, 41 },
+	{ 38, 11, 38, 190, 19, 46, 1, 19, 191, 105 },
+	{ 38, 48, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 39, 0, 239, 93, 0, 106, 119, 109, 181, 167 },
+	{ 39, 7, 172, 132, 24, 181, 32, 6, 157, 45 },
+	{ 39, 12, 34, 57, 138, 154, 142, 105, 173, 189 },
+	{ 39, 49, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 40, 2, 0, 103, 0, 98, 6, 160, 193, 78 },
+	{ 40, 10, 75, 107, 36, 35, 73, 156, 163, 67 },
+	{ 40, 13, 120, 163, 143, 36, 102, 82, 179, 180 },
+	{ 40, 50, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 41, 1, 129, 147, 0, 120, 48, 132, 191, 53 },
+	{ 41, 5, 229, 7, 2, 101, 47, 6, 197, 215 },
+	{ 41, 11, 118, 60, 55, 81, 19, 8, 167, 230 },
+	{ 41, 51, 0, 0, 0, 0, 0, 0, 0, 0 },
+};
+
+//    (QC) LDPC-
+/*
+1.    :       Z x Z -
+    ( `-1`)   ,     shift mod Z.
+2.    5G NR (TS 38.212, 5.3.2)    ,     
+    Z = a * 2^j (a  {2, 3, 5, 7, 9, 11, 13, 15}, Z <= 384);    Z.
+    BG1  BG2  (nrBaseGraph)        .
+*/
+struct QuasiCyclicBaseGraph {
+	//    
+	struct Entry {
+		int row; //   
+		int column; //   
+		vector<int> shifts; //  (   ,     5G NR)
+	};
+
+	int rows = 0; //    
+	int columns = 0; //    
+	int informationColumns = 0; //   
+	vector<Entry> entries; //  
+
+	static constexpr int liftingBases[8] = { 2, 3, 5, 7, 9, 11, 13, 15 }; //  a   5G NR
+	static constexpr int maxNRLiftingSize = 384; //    5G NR
+
+	//     5G NR  Z (-1,  Z      )
+	static int liftingSetIndex(int liftingSize) {
+		if (liftingSize < 2 || liftingSize > maxNRLiftingSize) return -1;
+		for (int set = 0; set < 8; set++) {
+			if (liftingSize % liftingBases[set] != 0) continue;
+			int power = liftingSize / liftingBases[set];
+			if ((power & (power - 1)) == 0) return set;
+		}
+		return -1;
+	}
+
+	//     (a * 2^j <= 384):   5G NR  
+	static int maxLiftingSize(int set) {
+		int size = liftingBases[set];
+		while (size * 2 <= maxNRLiftingSize) size *= 2;
+		return size;
+	}
+
+	//       Z
+	static int shift(const Entry& entry, int liftingSize) {
+		int set = 0;
+		if (entry.shifts.size() > 1) {
+			set = liftingSetIndex(liftingSize);
+			if (set < 0 || set >= static_cast<int>(entry.shifts.size())) {
+				throw invalid_argument("Lifting size is not in the 5G NR lifting sets");
+			}
+		}
+		return entry.shifts[set] % liftingSize;
+	}
+
+	//      (`-1` -  )
+	static QuasiCyclicBaseGraph fromMatrix(const vector<vector<int>>& shifts, int informationColumns) {
+		QuasiCyclicBaseGraph baseGraph;
+		baseGraph.rows = static_cast<int>(shifts.size());
+		baseGraph.columns = shifts.empty() ? 0 : static_cast<int>(shifts[0].size());
+		baseGraph.informationColumns = informationColumns;
+		if (informationColumns < 0 || informationColumns > baseGraph.columns) {
+			throw invalid_argument("Invalid base graph dimensions");
+		}
+		for (int row = 0; row < baseGraph.rows; row++) {
+			if (static_cast<int>(shifts[row].size()) != baseGraph.columns) {
+				throw invalid_argument("Invalid base graph dimensions");
+			}
+			for (int column = 0; column < baseGraph.columns; column++) {
+				if (shifts[row][column] >= 0) {
+					baseGraph.entries.push_back(Entry{ row, column, { shifts[row][column] } });
+				}
+			}
+		}
+		return baseGraph;
+	}
+
+	//   5G NR (1 - BG1 46 x 68, 2 - BG2 42 x 52)    5.3.2-2/5.3.2-3
+	static QuasiCyclicBaseGraph nrBaseGraph(int baseGraphIndex) {
+		if (baseGraphIndex != 1 && baseGraphIndex != 2) {
+			throw invalid_argument("5G NR base graph must be 1 or 2");
+		}
+		//      (    ;   - 1)
+		static const int rowDegrees1[46] = { 19, 19, 19, 19, 3, 8, 9, 7, 10, 9, 7, 8, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 5,
+			5, 6, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 4, 5, 4, 5, 5, 4 };
+		static const int columnDegrees1[26] = { 30, 28, 7, 11, 9, 4, 8, 12, 8, 7, 12, 10, 12, 11, 10, 7, 10, 10, 13, 7,
+			8, 11, 12, 5, 6, 6 };
+		static const int rowDegrees2[42] = { 8, 10, 8, 10, 4, 6, 6, 6, 4, 5, 5, 5, 4, 5, 5, 4, 5, 5, 4, 4, 4, 4, 3, 4,
+			4, 3, 5, 3, 4, 3, 5, 3, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4 };
+		static const int columnDegrees2[14] = { 22, 23, 10, 5, 5, 14, 7, 13, 6, 8, 9, 16, 9, 12 };
+
+		const bool first = baseGraphIndex == 1;
+		const int16_t(*table)[10] = first ? nrBaseGraph1Shifts : nrBaseGraph2Shifts;
+		const int entryCount = first ? 316 : 197;
+		QuasiCyclicBaseGraph baseGraph;
+		baseGraph.rows = first ? 46 : 42;
+		baseGraph.columns = first ? 68 : 52;
+		baseGraph.informationColumns = first ? 22 : 10;
+		for (int i = 0; i < entryCount; i++) {
+			baseGraph.entries.push_back(Entry{ table[i][0], table[i][1], vector<int>(table[i] + 2, table[i] + 10) });
+		}
+		baseGraph.validateNR(first ? rowDegrees1 : rowDegrees2, first ? columnDegrees1 : columnDegrees2);
+		return baseGraph;
+	}
+
+private:
+	//   5G NR    (   - runtime_error)
+	/*
+	1.       ,   iLS   Z  .
+	2.   ( 0..3,  Kb..Kb+3):  Kb+1..Kb+3 -     ,
+	     Kb  ,          (     ,
+	        Z).
+	3. :  i >= 4     0   Kb + i,      .
+	*/
+	void validateNR(const int* rowDegrees, const int* columnDegrees) const {
+		auto fail = [](const string& what) {
+			throw runtime_error("Inconsistent 5G NR base graph table: " + what);
+		};
+		const int core = informationColumns;
+		vector<int> rowCounts(rows, 0), columnCounts(columns, 0);
+		vector<const Entry*> coreEntries;
+		for (const Entry& entry : entries) {
+			string position = "(" + to_string(entry.row) + ", " + to_string(entry.column) + ")";
+			if (entry.row < 0 || entry.row >= rows || entry.column < 0 || entry.column >= columns || entry.shifts.size() != 8) {
+				fail("invalid entry " + position);
+			}
+			rowCounts[entry.row]++;
+			columnCounts[entry.column]++;
+			for (int set = 0; set < 8; set++) {
+				if (entry.shifts[set] < 0 || entry.shifts[set] >= maxLiftingSize(set)) {
+					fail("shift out of the lifting set range at " + position);
+				}
+			}
+			bool zero = all_of(entry.shifts.begin(), entry.shifts.end(), [](int shift) { return shift == 0; });
+			if (entry.column >= core + 4) {
+				if (entry.column != core + entry.row || !zero) fail("invalid extension block " + position);
+			}
+			else if (entry.column > core && entry.row < 4) {
+				if ((entry.row != entry.column - core - 1 && entry.row != entry.column - core) || !zero) {
+					fail("invalid double diagonal block " + position);
+				}
+			}
+			else if (entry.column == core && entry.row < 4) {
+				coreEntries.push_back(&entry);
+			}
+		}
+		for (int row = 0; row < rows; row++) {
+			if (rowCounts[row] != rowDegrees[row]) fail("degree of row " + to_string(row));
+		}
+		for (int column = 0; column < columns; column++) {
+			if (columnCounts[column] != (column < core + 4 ? columnDegrees[column] : 1)) fail("degree of column " + to_string(column));
+		}
+		if (coreEntries.size() != 3) {
+			fail("first parity column must have three core blocks");
+		}
+		for (int set = 0; set < 8; set++) {
+			int a = coreEntries[0]->shifts[set], b = coreEntries[1]->shifts[set], c = coreEntries[2]->shifts[set];
+			if (a != b && a != c && b != c) fail("singular parity core for lifting set " + to_string(set));
+		}
+	}
+};
+
+//   :  Z x Z,     
+//   rows + columns + 2 + 4 * ( )  -  Z    .
+//  , ,         ;  CSR-
+//     (OSD,  )   ,   .  
+//       .
+struct QuasiCyclicLayout {
+	int liftingSize = 0; //   Z (0 -   )
+	vector<int> rowOffsets; //       ( rows + 1)
+	vector<int> blockColumns; //     
+	vector<int> blockShifts; //     (  Z)
+	vector<int> columnOffsets; //        columnBlocks ( columns + 1)
+	vector<int> columnBlocks; //   (  blockColumns,   )
+	vector<int> blockRows; //     
+
+	int rowCount() const {
+		return rowOffsets.empty() ? 0 : static_cast<int>(rowOffsets.size()) - 1;
+	}
+
+	int checkCount() const {
+		return rowCount() * liftingSize;
+	}
+
+	int edgeCount() const {
+		return static_cast<int>(blockColumns.size()) * liftingSize;
+	}
+
+	//   column * Z + j:   (row, column)   s   row * Z + (j - s) mod Z
+	template <typename Visit>
+	void forEachCheck(int variable, Visit visit) const {
+		int column = variable / liftingSize, z = variable % liftingSize;
+		for (int k = columnOffsets[column]; k < columnOffsets[column + 1]; k++) {
+			int block = columnBlocks[k];
+			int check = z - blockShifts[block];
+			visit(blockRows[block] * liftingSize + (check < 0 ? check + liftingSize : check));
+		}
+	}
+
+	//        (   )
+	void indexColumns(int columnCount) {
+		blockRows.assign(blockColumns.size(), 0);
+		columnOffsets.assign(columnCount + 1, 0);
+		for (int row = 0; row < rowCount(); row++) {
+			for (int block = rowOffsets[row]; block < rowOffsets[row + 1]; block++) {
+				blockRows[block] = row;
+				columnOffsets[blockColumns[block] + 1]++;
+			}
+		}
+		for (int column = 0; column < columnCount; column++) {
+			columnOffsets[column + 1] += columnOffsets[column];
+		}
+		columnBlocks.resize(blockColumns.size());
+		vector<int> next(columnOffsets.begin(), columnOffsets.end() - 1);
+		for (int block = 0; block < static_cast<int>(blockColumns.size()); block++) {
+			columnBlocks[next[blockColumns[block]]++] = block;
+		}
+	}
+
+	int maxRowDegree() const {
+		int degree = 0;
+		for (int row = 0; row < rowCount(); row++) {
+			degree = max(degree, rowOffsets[row + 1] - rowOffsets[row]);
+		}
+		return degree;
+	}
+
+	//   :  row * Z + z    column * Z + (z + shift) mod Z
+	//        ,     CSR - rowOffsets[row] * Z + z * degree + k.
+	vector<Edge> expandEdges() const {
+		vector<Edge> edges;
+		edges.reserve(blockColumns.size() * liftingSize);
+		for (int row = 0; row < rowCount(); row++) {
+			for (int z = 0; z < liftingSize; z++) {
+				for (int block = rowOffsets[row]; block < rowOffsets[row + 1]; block++) {
+					edges.push_back(Edge{ blockColumns[block] * liftingSize + (z + blockShifts[block]) % liftingSize, row * liftingSize + z });
+				}
+			}
+		}
+		return edges;
+	}
+
+	//        (   )
+	QuasiCyclicLayout withoutColumns(const vector<char>& isRemoved) const {
+		QuasiCyclicLayout layout;
+		layout.liftingSize = liftingSize;
+		layout.rowOffsets.assign(1, 0);
+		for (int row = 0; row < rowCount(); row++) {
+			for (int block = rowOffsets[row]; block < rowOffsets[row + 1]; block++) {
+				if (isRemoved[blockColumns[block]]) continue;
+				layout.blockColumns.push_back(blockColumns[block]);
+				layout.blockShifts.push_back(blockShifts[block]);
+			}
+			layout.rowOffsets.push_back(static_cast<int>(layout.blockColumns.size()));
+		}
+		layout.indexColumns(static_cast<int>(columnOffsets.size()) - 1);
+		return layout;
+	}
+
+	//      Z (     )
+	static QuasiCyclicLayout lift(const QuasiCyclicBaseGraph& baseGraph, int liftingSize) {
+		if (liftingSize < 1) {
+			throw invalid_argument("Lifting size must be positive");
+		}
+		vector<const QuasiCyclicBaseGraph::Entry*> entries;
+		for (const auto& entry : baseGraph.entries) {
+			entries.push_back(&entry);
+		}
+		sort(entries.begin(), entries.end(), [](const auto* a, const auto* b) {
+			return a->row != b->row ? a->row < b->row : a->column < b->column;
+			});
+
+		QuasiCyclicLayout layout;
+		layout.liftingSize = liftingSize;
+		layout.rowOffsets.assign(baseGraph.rows + 1, 0);
+		for (size_t i = 0; i < entries.size(); i++) {
+			if (i > 0 && entries[i]->row == entries[i - 1]->row && entries[i]->column == entries[i - 1]->column) {
+				throw invalid_argument("Duplicate base graph entry");
+			}
+			layout.rowOffsets[entries[i]->row + 1]++;
+			layout.blockColumns.push_back(entries[i]->column);
+			layout.blockShifts.push_back(QuasiCyclicBaseGraph::shift(*entries[i], liftingSize));
+		}
+		for (int row = 0; row < baseGraph.rows; row++) {
+			layout.rowOffsets[row + 1] += layout.rowOffsets[row];
+		}
+		layout.indexColumns(baseGraph.columns);
+		return layout;
+	}
+};
+
+//      PEG (Progressive Edge Growth)
+/*
+1.    :      ,  
+         (  ),   -    .
+2.   ( checkNodeDegree)  ,   ;   .
+3.      :    ,   ,
+          (   ).
+4.   searchLimit  :     PEG    
+     ;      (       ).
+5.       ,     .
+    -   mt19937_64    (   ,
+  ),            .
+*/
+class ProgressiveEdgeGrowth {
 private:
-	map<int, double> receivedMessage; // ,      
+	int variableNodeDegree; //   
+	int checkNodeDegree; //   
+	vector<int> variableChecks; //    ( variableNodeDegree )
+	vector<int> variableDegrees; //   
+	vector<int> checkVariables; //    ( checkNodeDegree )
+	vector<int> checkDegrees; //   
+	vector<vector<int>> buckets; //     
+	vector<int> bucketPositions; //     
+	int nonFullCount; //   
+	vector<int> checkStamps; //  ,  
+	vector<int> checkLevels; //  ,    
+	vector<int> variableStamps; //  ,  
+	int stamp = 0; //   
+	vector<int> reachedPerDegree; //     
+	int reachedNonFull = 0; //   
+	int visitedCount = 0; //  
+	int level = 0; //   
+	vector<int> frontier, nextFrontier; //      
+	vector<int> lastLevel; //  ,     
+	mt19937_64 generator;
+	static const int searchLimit = 2048; //     
+
+	ProgressiveEdgeGrowth(int length, int checkCount, int variableNodeDegree, int checkNodeDegree, uint64_t seed)
+		: variableNodeDegree(variableNodeDegree), checkNodeDegree(checkNodeDegree),
+		variableChecks(static_cast<size_t>(length) * variableNodeDegree), variableDegrees(length, 0),
+		checkVariables(static_cast<size_t>(checkCount) * checkNodeDegree), checkDegrees(checkCount, 0),
+		buckets(checkNodeDegree), bucketPositions(checkCount), nonFullCount(checkCount),
+		checkStamps(checkCount, 0), checkLevels(checkCount, 0), variableStamps(length, 0), reachedPerDegree(checkNodeDegree), generator(seed) {
+		for (int c = 0; c < checkCount; c++) {
+			bucketPositions[c] = c;
+			buckets[0].push_back(c);
+		}
+	}
+
+	int random(int bound) {
+		return static_cast<int>(generator() % static_cast<uint64_t>(bound));
+	}
+
+	bool isAdjacent(int variable, int check) const {
+		const int* checks = variableChecks.data() + static_cast<size_t>(variable) * variableNodeDegree;
+		return find(checks, checks + variableDegrees[variable], check) != checks + variableDegrees[variable];
+	}
+
+	//     
+	void visit(int check, vector<int>& levelChecks) {
+		checkStamps[check] = stamp;
+		checkLevels[check] = level;
+		visitedCount++;
+		levelChecks.push_back(check);
+		if (checkDegrees[check] < checkNodeDegree) {
+			reachedNonFull++;
+			reachedPerDegree[checkDegrees[check]]++;
+			lastLevel.push_back(check);
+		}
+	}
+
+	//     
+	int pickUnreached() {
+		int degree = 0;
+		while (reachedPerDegree[degree] == static_cast<int>(buckets[degree].size())) degree++;
+		const vector<int>& bucket = buckets[degree];
+		int unreached = static_cast<int>(bucket.size()) - reachedPerDegree[degree];
+
+		//   -   ,    (    )
+		if (2 * unreached >= static_cast<int>(bucket.size())) {
+			while (true) {
+				int check = bucket[random(static_cast<int>(bucket.size()))];
+				if (checkStamps[check] != stamp) return check;
+			}
+		}
+		int index = random(unreached);
+		for (int check : bucket) {
+			if (checkStamps[check] != stamp && index-- == 0) return check;
+		}
+		return -1;
+	}
+
+	//        
+	int pickLowestDegree() {
+		int best = -1, ties = 0;
+		for (int check : lastLevel) {
+			if (best >= 0 && checkDegrees[check] > checkDegrees[best]) continue;
+			if (best < 0 || checkDegrees[check] < checkDegrees[best]) {
+				best = check;
+				ties = 1;
+			}
+			else if (random(++ties) == 0) {
+				best = check;
+			}
+		}
+		return best;
+	}
+
+	//         (     )
+	bool isNextLevelCovering() const {
+		for (const auto& bucket : buckets) {
+			for (int check : bucket) {
+				if (checkStamps[check] == stamp) continue;
+				bool covered = false;
+				const int* variables = checkVariables.data() + static_cast<size_t>(check) * checkNodeDegree;
+				for (int k = 0; k < checkDegrees[check] && !covered; k++) {
+					const int* checks = variableChecks.data() + static_cast<size_t>(variables[k]) * variableNodeDegree;
+					for (int j = 0; j < variableDegrees[variables[k]] && !covered; j++) {
+						covered = checkStamps[checks[j]] == stamp && checkLevels[checks[j]] == level;
+					}
+				}
+				if (!covered) return false;
+			}
+		}
+		return true;
+	}
+
+	//      (-1,        )
+	int selectCheck(int variable) {
+		stamp++;
+		fill(reachedPerDegree.begin(), reachedPerDegree.end(), 0);
+		reachedNonFull = 0;
+		visitedCount = 0;
+		level = 0;
+		frontier.clear();
+		lastLevel.clear();
+		variableStamps[variable] = stamp;
+		for (int k = 0; k < variableDegrees[variable]; k++) {
+			visit(variableChecks[static_cast<size_t>(variable) * variableNodeDegree + k], frontier);
+		}
+
+		for (bool first = true;; first = false) {
+			int unreached = nonFullCount - reachedNonFull;
+			if (unreached == 0) return first ? -1 : pickLowestDegree();
+			if (frontier.empty() || visitedCount >= searchLimit) return pickUnreached();
+			if (unreached < static_cast<int>(frontier.size()) && isNextLevelCovering()) return pickUnreached();
+
+			level++;
+			lastLevel.clear();
+			nextFrontier.clear();
+			for (int check : frontier) {
+				if (visitedCount >= searchLimit) break;
+				const int* variables = checkVariables.data() + static_cast<size_t>(check) * checkNodeDegree;
+				for (int k = 0; k < checkDegrees[check]; k++) {
+					int neighbor = variables[k];
+					if (variableStamps[neighbor] == stamp) continue;
+					variableStamps[neighbor] = stamp;
+					const int* checks = variableChecks.data() + static_cast<size_t>(neighbor) * variableNodeDegree;
+					for (int j = 0; j < variableDegrees[neighbor]; j++) {
+						if (checkStamps[checks[j]] != stamp) visit(checks[j], nextFrontier);
+					}
+				}
+			}
+			swap(frontier, nextFrontier);
+		}
+	}
+
+	void connect(int variable, int check) {
+		variableChecks[static_cast<size_t>(variable) * variableNodeDegree + variableDegrees[variable]++] = check;
+		checkVariables[static_cast<size_t>(check) * checkNodeDegree + checkDegrees[check]] = variable;
+
+		//      
+		vector<int>& bucket = buckets[checkDegrees[check]];
+		int moved = bucket.back();
+		bucket[bucketPositions[check]] = moved;
+		bucketPositions[moved] = bucketPositions[check];
+		bucket.pop_back();
+		if (++checkDegrees[check] < checkNodeDegree) {
+			bucketPositions[check] = static_cast<int>(buckets[checkDegrees[check]].size());
+			buckets[checkDegrees[check]].push_back(check);
+		}
+		else {
+			nonFullCount--;
+		}
+	}
+
+	//       :  (u, c')    
+	//   c (u, c),    c';   ,   
+	void connectBySwap(int variable) {
+		int check = buckets[0].empty() ? -1 : buckets[0][0];
+		for (int d = 1; check < 0; d++) {
+			if (!buckets[d].empty()) check = buckets[d][0];
+		}
+		int start = random(variable);
+		for (int i = 0; i < variable; i++) {
+			int other = (start + i) % variable;
+			if (isAdjacent(other, check)) continue;
+			int* checks = variableChecks.data() + static_cast<size_t>(other) * variableNodeDegree;
+			for (int k = 0; k < variableNodeDegree; k++) {
+				int swapped = checks[k];
+				if (isAdjacent(variable, swapped)) continue;
+
+				int* variables = checkVariables.data() + static_cast<size_t>(swapped) * checkNodeDegree;
+				*find(variables, variables + checkNodeDegree, other) = variable;
+				variableChecks[static_cast<size_t>(variable) * variableNodeDegree + variableDegrees[variable]++] = swapped;
+				variableDegrees[other]--;
+				checks[k] = checks[variableDegrees[other]];
+				connect(other, check);
+				return;
+			}
+		}
+		throw invalid_argument("Cannot build PEG graph for this length and degree combination");
+	}
+
+public:
+	//    (length   variableNodeDegree,   checkNodeDegree)
+	static vector<Edge> build(int length, int variableNodeDegree, int checkNodeDegree, uint64_t seed) {
+		if (length <= 0 || variableNodeDegree <= 0 || checkNodeDegree <= 0 || length * variableNodeDegree % checkNodeDegree != 0) {
+			throw invalid_argument("Invalid length and degree combination");
+		}
+		int checkCount = length * variableNodeDegree / checkNodeDegree;
+		if (variableNodeDegree > checkCount) {
+			throw invalid_argument("Invalid length and degree combination");
+		}
+
+		ProgressiveEdgeGrowth growth(length, checkCount, variableNodeDegree, checkNodeDegree, seed);
+		for (int v = 0; v < length; v++) {
+			for (int k = 0; k < variableNodeDegree; k++) {
+				int check = growth.selectCheck(v);
+				if (check >= 0) {
+					growth.connect(v, check);
+				}
+				else {
+					growth.connectBySwap(v);
+				}
+			}
+		}
+
+		vector<Edge> edges;
+		edges.reserve(growth.variableChecks.size());
+		for (int v = 0; v < length; v++) {
+			for (int k = 0; k < variableNodeDegree; k++) {
+				edges.push_back(Edge{ v, growth.variableChecks[static_cast<size_t>(v) * variableNodeDegree + k] });
+			}
+		}
+		return edges;
+	}
+};
+
+//      (    - )
+/*
+1.      .   ()  , 
+    .  :        -
+       T (    ,   IRA  DVB-S2,  
+     ).          
+       ()   .
+2.   ( g,  )    T    
+        - ;   -   ,  
+     .    .
+3.   -    T   .    [0, systematicColumns)
+   ,        H;  ( ) T 
+    ,       freeColumns,     .
+4.    : g   - AND  XOR  64-      ,
+    T -     .  O(g * N / 64 + E).
+*/
+struct SystematicEncoder {
+	int variableCount = 0; //   
+	int wordCount = 0; // 64-    
+	vector<int> freeColumns; //     (  )
+	vector<int> pivotColumns; //    
+	vector<uint64_t> pivotRows; //      (pivotColumns.size() * wordCount)
+	vector<int> triangularColumns; //  T   
+	vector<int> triangularOffsets; //     T  triangularInputs ( T + 1)
+	vector<int> triangularInputs; //    
+
+	static int getBit(const uint64_t* words, int index) {
+		return (words[index >> 6] >> (index & 63)) & 1;
+	}
+
+	static void flipBit(uint64_t* words, int index) {
+		words[index >> 6] ^= uint64_t(1) << (index & 63);
+	}
+
+	//  bit    index   (   )
+	static void setBit(uint64_t* words, int index, int bit) {
+		words[index >> 6] |= uint64_t(bit) << (index & 63);
+	}
+
+	//    (    )
+	int gap() const {
+		return static_cast<int>(pivotColumns.size());
+	}
+
+	//     GF(2)
+	int rank() const {
+		return static_cast<int>(triangularColumns.size() + pivotColumns.size());
+	}
+
+	//   :    words    ,  - 
+	void encode(uint64_t* words) const {
+		for (size_t k = 0; k < pivotColumns.size(); k++) {
+			const uint64_t* row = pivotRows.data() + k * wordCount;
+			uint64_t parity = 0;
+			for (int w = 0; w < wordCount; w++) {
+				parity ^= row[w] & words[w];
+			}
+			setBit(words, pivotColumns[k], __builtin_parityll(parity));
+		}
+		for (size_t t = 0; t < triangularColumns.size(); t++) {
+			int bit = 0;
+			for (int k = triangularOffsets[t]; k < triangularOffsets[t + 1]; k++) {
+				bit ^= getBit(words, triangularInputs[k]);
+			}
+			setBit(words, triangularColumns[t], bit);
+		}
+	}
+
+	//      [0, systematicColumns)
+	//  -  ,     ( )   H;
+	//  T   ,    (      ).
+	static SystematicEncoder build(const TannerGraph& graph, int systematicColumns) {
+		SystematicEncoder unconstrained = triangulate(graph, 0);
+		if (systematicColumns == 0) return unconstrained;
+
+		vector<Edge> parityEdges;
+		for (int c = 0; c < graph.checkCount; c++) {
+			for (int e = graph.checkOffsets[c]; e < graph.checkOffsets[c + 1]; e++) {
+				if (graph.edgeVariables[e] >= systematicColumns) parityEdges.push_back(Edge{ graph.edgeVariables[e] - systematicColumns, c });
+			}
+		}
+		TannerGraph parityPart = TannerGraph::build(graph.variableCount - systematicColumns, graph.checkCount, parityEdges);
+		if (triangulate(parityPart, 0).rank() != unconstrained.rank()) return unconstrained;
+		return triangulate(graph, systematicColumns);
+	}
+
+private:
+	static SystematicEncoder triangulate(const TannerGraph& graph, int systematicColumns) {
+		int variableCount = graph.variableCount;
+		int checkCount = graph.checkCount;
+		SystematicEncoder encoder;
+		encoder.variableCount = variableCount;
+		encoder.wordCount = (variableCount + 63) / 64;
+
+		//  H  GF(2):   ( )  
+		vector<int> rowOffsets(checkCount + 1, 0), rowColumns;
+		rowColumns.reserve(graph.edgeCount());
+		for (int c = 0; c < checkCount; c++) {
+			size_t begin = rowColumns.size();
+			rowColumns.insert(rowColumns.end(), graph.edgeVariables.begin() + graph.checkOffsets[c], graph.edgeVariables.begin() + graph.checkOffsets[c + 1]);
+			sort(rowColumns.begin() + begin, rowColumns.end());
+			size_t end = begin;
+			for (size_t i = begin; i < rowColumns.size();) {
+				size_t j = i;
+				while (j < rowColumns.size() && rowColumns[j] == rowColumns[i]) j++;
+				if ((j - i) % 2) rowColumns[end++] = rowColumns[i];
+				i = j;
+			}
+			rowColumns.resize(end);
+			rowOffsets[c + 1] = static_cast<int>(end);
+		}
+		vector<int> columnOffsets(variableCount + 1, 0), columnRows(rowColumns.size());
+		for (int v : rowColumns) columnOffsets[v + 1]++;
+		for (int v = 0; v < variableCount; v++) columnOffsets[v + 1] += columnOffsets[v];
+		vector<int> next(columnOffsets.begin(), columnOffsets.end() - 1);
+		for (int c = 0; c < checkCount; c++) {
+			for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+				columnRows[next[rowColumns[k]]++] = c;
+			}
+		}
+
+		//   T:  -        .
+		//   1 -  ,  >= 2 -     (  ).
+		vector<char> isKnown(variableCount, 0), isRowUsed(checkCount, 0), isTriangular(variableCount, 0), isGap(variableCount, 0);
+		vector<int> rowDegree(checkCount, 0), columnDegree(variableCount, 0), triangularRows, gapColumns, queue;
+		fill(isKnown.begin(), isKnown.begin() + systematicColumns, 1);
+		for (int v = 0; v < variableCount; v++) {
+			columnDegree[v] = columnOffsets[v + 1] - columnOffsets[v];
+		}
+		int maxRowDegree = 0;
+		for (int c = 0; c < checkCount; c++) {
+			for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+				rowDegree[c] += !isKnown[rowColumns[k]];
+			}
+			maxRowDegree = max(maxRowDegree, rowDegree[c]);
+		}
+		vector<vector<int>> buckets(maxRowDegree + 1);
+		auto pushRow = [&](int c) {
+			if (rowDegree[c] == 1) queue.push_back(c);
+			else if (rowDegree[c] >= 2) buckets[rowDegree[c]].push_back(c);
+		};
+		for (int c = 0; c < checkCount; c++) {
+			pushRow(c);
+		}
+		auto markKnown = [&](int v) {
+			isKnown[v] = 1;
+			for (int k = columnOffsets[v]; k < columnOffsets[v + 1]; k++) {
+				int c = columnRows[k];
+				rowDegree[c]--;
+				if (!isRowUsed[c]) pushRow(c);
+			}
+		};
+		size_t head = 0;
+		while (true) {
+			while (head < queue.size()) {
+				int c = queue[head++];
+				if (isRowUsed[c] || rowDegree[c] != 1) continue;
+				int column = -1;
+				for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+					if (!isKnown[rowColumns[k]]) column = rowColumns[k];
+				}
+				isRowUsed[c] = 1;
+				for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+					columnDegree[rowColumns[k]]--;
+				}
+				isTriangular[column] = 1;
+				encoder.triangularColumns.push_back(column);
+				triangularRows.push_back(c);
+				markKnown(column);
+			}
+
+			int best = -1;
+			for (size_t degree = 2; degree < buckets.size() && best < 0; degree++) {
+				while (!buckets[degree].empty() && best < 0) {
+					int c = buckets[degree].back();
+					buckets[degree].pop_back();
+					if (!isRowUsed[c] && rowDegree[c] == static_cast<int>(degree)) best = c;
+				}
+			}
+			if (best < 0) break;
+			int column = -1;
+			for (int k = rowOffsets[best]; k < rowOffsets[best + 1]; k++) {
+				int v = rowColumns[k];
+				if (!isKnown[v] && (column < 0 || columnDegree[v] > columnDegree[column])) column = v;
+			}
+			isGap[column] = 1;
+			gapColumns.push_back(column);
+			markKnown(column);
+		}
+
+		encoder.triangularOffsets.push_back(0);
+		for (size_t t = 0; t < triangularRows.size(); t++) {
+			int c = triangularRows[t];
+			for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+				if (rowColumns[k] != encoder.triangularColumns[t]) encoder.triangularInputs.push_back(rowColumns[k]);
+			}
+			encoder.triangularOffsets.push_back(static_cast<int>(encoder.triangularInputs.size()));
+		}
+
+		//     T:      ( 
+		//       T).  : T -   
+		//  [0, triangularWords * 64),  -  ;    T   .
+		int triangularCount = static_cast<int>(triangularRows.size());
+		int triangularWords = (triangularCount + 63) / 64;
+		vector<int> position(variableCount), restColumns;
+		for (int t = 0; t < triangularCount; t++) {
+			position[encoder.triangularColumns[t]] = t;
+		}
+		for (int v : gapColumns) {
+			position[v] = triangularWords * 64 + static_cast<int>(restColumns.size());
+			restColumns.push_back(v);
+		}
+		for (int v = variableCount - 1; v >= 0; v--) {
+			if (isTriangular[v] || isGap[v]) continue;
+			position[v] = triangularWords * 64 + static_cast<int>(restColumns.size());
+			restColumns.push_back(v);
+		}
+		int restWords = (static_cast<int>(restColumns.size()) + 63) / 64;
+		vector<uint64_t> rows, scratch(triangularWords + restWords);
+		size_t rowCount = 0;
+		for (int c = 0; c < checkCount; c++) {
+			if (isRowUsed[c]) continue;
+			fill(scratch.begin(), scratch.end(), 0);
+			for (int k = rowOffsets[c]; k < rowOffsets[c + 1]; k++) {
+				flipBit(scratch.data(), position[rowColumns[k]]);
+			}
+			for (int w = triangularWords - 1; w >= 0; w--) {
+				while (scratch[w]) {
+					int t = w * 64 + 63 - __builtin_clzll(scratch[w]);
+					int r = triangularRows[t];
+					for (int k = rowOffsets[r]; k < rowOffsets[r + 1]; k++) {
+						flipBit(scratch.data(), position[rowColumns[k]]);
+					}
+				}
+			}
+			rows.insert(rows.end(), scratch.begin() + triangularWords, scratch.end());
+			rowCount++;
+		}
+
+		//  - :  -   ,     ( restColumns)
+		auto row = [&](size_t r) { return rows.data() + r * restWords; };
+		vector<char> isPivot(variableCount, 0);
+		vector<int> pivotPositions;
+		size_t pivotCount = 0;
+		for (int j = 0; j < static_cast<int>(restColumns.size()) && pivotCount < rowCount; j++) {
+			size_t found = pivotCount;
+			while (found < rowCount && !getBit(row(found), j)) found++;
+			if (found == rowCount) continue;
+			swap_ranges(row(found), row(found) + restWords, row(pivotCount));
+			const uint64_t* pivot = row(pivotCount);
+			for (size_t r = 0; r < rowCount; r++) {
+				if (r == pivotCount || !getBit(row(r), j)) continue;
+				uint64_t* target = row(r);
+				for (int w = 0; w < restWords; w++) {
+					target[w] ^= pivot[w];
+				}
+			}
+			isPivot[restColumns[j]] = 1;
+			encoder.pivotColumns.push_back(restColumns[j]);
+			pivotPositions.push_back(j);
+			pivotCount++;
+		}
+
+		//       (  )
+		int wordCount = encoder.wordCount;
+		encoder.pivotRows.assign(pivotCount * wordCount, 0);
+		for (size_t k = 0; k < pivotCount; k++) {
+			flipBit(row(k), pivotPositions[k]);
+			for (int w = 0; w < restWords; w++) {
+				for (uint64_t bits = row(k)[w]; bits; bits &= bits - 1) {
+					flipBit(encoder.pivotRows.data() + k * wordCount, restColumns[w * 64 + __builtin_ctzll(bits)]);
+				}
+			}
+		}
+
+		for (int v = 0; v < variableCount; v++) {
+			if (!isTriangular[v] && !isPivot[v]) encoder.freeColumns.push_back(v);
+		}
+		return encoder;
+	}
+};
+
+//       
+/*
+1.           64- .
+2.    LLR       .
+3.     ,   -   .
+4.    LLR  :   ,   .
+*/
+struct SyndromeTracker {
+	vector<uint64_t> hardDecisions; //   (1 -  LLR)
+	vector<uint64_t> undecided; //    LLR
+	vector<uint64_t> checkParities; //    (1 -   )
+	int unsatisfiedCount = 0; //   
+	int undecidedCount = 0; //     LLR
+
+	//  :     ,   
+	void reset(int variableCount, int checkCount) {
+		hardDecisions.assign((variableCount + 63) / 64, 0);
+		undecided.assign((variableCount + 63) / 64, ~uint64_t(0));
+		checkParities.assign((checkCount + 63) / 64, 0);
+		unsatisfiedCount = 0;
+		undecidedCount = variableCount;
+	}
+
+	//    LLR   (graph - TannerGraph  QuasiCyclicLayout)
+	template <typename Graph>
+	void update(const Graph& graph, int variable, double llr) {
+		uint64_t mask = uint64_t(1) << (variable & 63);
+		uint64_t& zero = undecided[variable >> 6];
+		if (((zero & mask) != 0) != (llr == 0)) {
+			zero ^= mask;
+			undecidedCount += (llr == 0) ? 1 : -1;
+		}
+		if (getDecision(variable) != (llr < 0)) flip(graph, variable);
+	}
+
+	//    ( )    
+	uint64_t hashDecisions() const {
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < hardDecisions.size(); i++) {
+			hash = (hash ^ hardDecisions[i]) * 0x100000001b3ULL;
+			hash = (hash ^ undecided[i]) * 0x100000001b3ULL;
+		}
+		return hash ^ (hash >> 29);
+	}
+
+	//         
+	template <typename Graph>
+	void flip(const Graph& graph, int variable) {
+		hardDecisions[variable >> 6] ^= uint64_t(1) << (variable & 63);
+		graph.forEachCheck(variable, [this](int check) {
+			uint64_t checkMask = uint64_t(1) << (check & 63);
+			uint64_t& parity = checkParities[check >> 6];
+			parity ^= checkMask;
+			unsatisfiedCount += (parity & checkMask) ? 1 : -1;
+			});
+	}
+
+	int getDecision(int variable) const {
+		return (hardDecisions[variable >> 6] >> (variable & 63)) & 1;
+	}
+
+	bool isSatisfied() const {
+		return unsatisfiedCount == 0 && undecidedCount == 0;
+	}
+};
+
+//       (StoppingCriteria)
+struct IterationMonitor {
+	static constexpr int historySize = 8; //    (   )
+
+	uint64_t history[historySize] = {}; //     ( )
+	int historyCount = 0;
+	int stableIterations = 0; //     
+	int bestUnsatisfiedCount = 0; //    
+	int plateauIterations = 0; //    bestUnsatisfiedCount
+	int oscillatingIterations = 0; //       
+
+	void reset() {
+		historyCount = 0;
+		stableIterations = plateauIterations = oscillatingIterations = 0;
+		bestUnsatisfiedCount = INT32_MAX;
+	}
+
+	//    ; true  reason -     
+	bool observe(const SyndromeTracker& syndrome, const StoppingCriteria& criteria, TerminationReason& reason) {
+		uint64_t hash = syndrome.hashDecisions();
+		bool unchanged = historyCount > 0 && history[(historyCount - 1) % historySize] == hash;
+		bool repeated = false;
+		for (int i = 2; i <= min(historyCount, historySize) && !unchanged && !repeated; i++) {
+			repeated = history[(historyCount - i) % historySize] == hash;
+		}
+		history[historyCount % historySize] = hash;
+		historyCount++;
+
+		stableIterations = unchanged ? stableIterations + 1 : 0;
+		oscillatingIterations = repeated ? oscillatingIterations + 1 : 0;
+		if (syndrome.unsatisfiedCount < bestUnsatisfiedCount) {
+			bestUnsatisfiedCount = syndrome.unsatisfiedCount;
+			plateauIterations = 0;
+		}
+		else {
+			plateauIterations++;
+		}
+
+		if (criteria.stagnationIterations > 0 && stableIterations >= criteria.stagnationIterations) reason = TerminationReason::Stagnation;
+		else if (criteria.oscillationIterations > 0 && oscillatingIterations >= criteria.oscillationIterations) reason = TerminationReason::Oscillation;
+		else if (criteria.plateauIterations > 0 && plateauIterations >= criteria.plateauIterations) reason = TerminationReason::Plateau;
+		else return false;
+		return true;
+	}
+};
+
+//  max-     (residual BP)
+//   -     C2V,      .
+struct ResidualQueue {
+	vector<int> heap; //    
+	vector<int> positions; //     (-1 -    )
+	vector<double> residuals; //  
+
+	void reset(int nodeCount) {
+		heap.clear();
+		heap.reserve(nodeCount);
+		positions.assign(nodeCount, -1);
+		residuals.assign(nodeCount, 0.0);
+	}
+
+	bool empty() const {
+		return heap.empty();
+	}
+
+	double topResidual() const {
+		return residuals[heap[0]];
+	}
+
+	//    (   ,    )
+	void update(int node, double residual) {
+		residuals[node] = residual;
+		if (positions[node] < 0) {
+			positions[node] = static_cast<int>(heap.size());
+			heap.push_back(node);
+		}
+		siftUp(positions[node]);
+		siftDown(positions[node]);
+	}
+
+	//     
+	int pop() {
+		int node = heap[0];
+		positions[node] = -1;
+		int last = heap.back();
+		heap.pop_back();
+		if (!heap.empty()) {
+			heap[0] = last;
+			positions[last] = 0;
+			siftDown(0);
+		}
+		return node;
+	}
+
+private:
+	void place(int position, int node) {
+		heap[position] = node;
+		positions[node] = position;
+	}
+
+	void siftUp(int position) {
+		int node = heap[position];
+		while (position > 0) {
+			int parent = (position - 1) / 2;
+			if (residuals[heap[parent]] >= residuals[node]) break;
+			place(position, heap[parent]);
+			position = parent;
+		}
+		place(position, node);
+	}
+
+	void siftDown(int position) {
+		int node = heap[position];
+		int count = static_cast<int>(heap.size());
+		while (true) {
+			int child = 2 * position + 1;
+			if (child >= count) break;
+			if (child + 1 < count && residuals[heap[child + 1]] > residuals[heap[child]]) child++;
+			if (residuals[heap[child]] <= residuals[node]) break;
+			place(position, heap[child]);
+			position = child;
+		}
+		place(position, node);
+	}
+};
+
+//  OSD (ordered statistics decoding)  w   LLR  BP
+/*
+1.    ( )    |LLR|,   ;
+       ,     64- .
+2.   -      :   -   ,
+        (MRB).    -    ,
+         .
+3.   0 -   .        -
+         (AND     ).  
+     w  :     ,     1,
+            XOR  .
+4.   -  |LLR| ,      .  
+      :   |LLR|      ,
+        ,    .
+  O(M * rank * N / 64),    C(N - rank, w)  .
+*/
+struct OrderedStatisticsDecoder {
+	static constexpr double reliabilityLimit = 1e100; //  |LLR|:  LLR    
+
+	vector<double> llrs; //  LLR  ( , codeLength )
+	vector<int> codeword; //    (codeLength ,  - )
+	long long patternCount = 0; //    
+
+	//     llrs; frozenBitIndexes - ,    (  )
+	void decode(const TannerGraph& graph, const vector<int>& frozenBitIndexes, int order) {
+		int variableCount = graph.variableCount;
+		sortPositions(variableCount, frozenBitIndexes);
+		eliminate(graph);
+		collectBasis();
+
+		//   0:  -      
+		differences.assign(size_t(order + 1) * pivotWords, 0);
+		for (int r = 0; r < rank(); r++) {
+			const uint64_t* row = rows.data() + size_t(r) * columnWords;
+			uint64_t parity = 0;
+			for (int w = 0; w < columnWords; w++) {
+				parity ^= row[w] & hardDecisions[w];
+			}
+			differences[r >> 6] |= uint64_t(__builtin_parityll(parity)) << (r & 63);
+		}
+		patternCount = 0;
+		flips.resize(order);
+		bestFlips.clear();
+		bestDifference.assign(differences.begin(), differences.begin() + pivotWords);
+		bestMetric = discrepancy(differences.data(), INFINITY);
+		if (order > 0) search(0, 0, 0.0);
+
+		codeword.assign(variableCount, 0);
+		for (int j = 0; j < positionCount(); j++) {
+			codeword[positions[j]] = (hardDecisions[j >> 6] >> (j & 63)) & 1;
+		}
+		for (int b : bestFlips) {
+			codeword[positions[basisColumns[b]]] ^= 1;
+		}
+		for (int r = 0; r < rank(); r++) {
+			codeword[positions[pivotColumns[r]]] ^= (bestDifference[r >> 6] >> (r & 63)) & 1;
+		}
+	}
+
+private:
+	vector<int> positions; //      ( )
+	vector<int> columnOf; //   (-1 - )
+	vector<double> reliabilities; //  |LLR| 
+	vector<uint64_t> hardDecisions; //    ()
+	int columnWords = 0; //    
+	vector<uint64_t> rows; //   (checkCount * columnWords),    rank - 
+	vector<int> pivotColumns; //    
+	vector<double> pivotReliabilities; //    
+	int pivotWords = 0; //      
+	vector<int> basisColumns; //     
+	vector<int> basisIndexOf; //     (-1 - )
+	vector<uint64_t> basisMasks; //      (basisColumns.size() * pivotWords)
+	vector<uint64_t> differences; //        ((order + 1) * pivotWords)
+	vector<int> flips, bestFlips; //    (  basisColumns):    
+	vector<uint64_t> bestDifference; //   
+	double bestMetric = 0; //   
+
+	int positionCount() const {
+		return static_cast<int>(positions.size());
+	}
+
+	int rank() const {
+		return static_cast<int>(pivotColumns.size());
+	}
+
+	void sortPositions(int variableCount, const vector<int>& frozenBitIndexes) {
+		columnOf.assign(variableCount, 0);
+		for (int index : frozenBitIndexes) {
+			columnOf[index] = -1;
+		}
+		positions.clear();
+		for (int v = 0; v < variableCount; v++) {
+			if (columnOf[v] == 0) positions.push_back(v);
+		}
+		sort(positions.begin(), positions.end(), [this](int a, int b) {
+			return fabs(llrs[a]) < fabs(llrs[b]) || (fabs(llrs[a]) == fabs(llrs[b]) && a < b);
+			});
+
+		columnWords = (positionCount() + 63) / 64;
+		reliabilities.resize(positionCount());
+		hardDecisions.assign(columnWords, 0);
+		for (int j = 0; j < positionCount(); j++) {
+			int v = positions[j];
+			columnOf[v] = j;
+			reliabilities[j] = min(fabs(llrs[v]), reliabilityLimit);
+			hardDecisions[j >> 6] |= uint64_t(llrs[v] < 0) << (j & 63);
+		}
+	}
+
+	//    GF(2) (  )      - 
+	void eliminate(const TannerGraph& graph) {
+		int checkCount = graph.checkCount;
+		rows.assign(size_t(checkCount) * columnWords, 0);
+		for (int c = 0; c < checkCount; c++) {
+			uint64_t* row = rows.data() + size_t(c) * columnWords;
+			for (int e = graph.checkOffsets[c]; e < graph.checkOffsets[c + 1]; e++) {
+				int j = columnOf[graph.edgeVariables[e]];
+				if (j >= 0) row[j >> 6] ^= uint64_t(1) << (j & 63);
+			}
+		}
+
+		//          ,  XOR -   
+		pivotColumns.clear();
+		for (int j = 0; j < positionCount() && rank() < checkCount; j++) {
+			int word = j >> 6;
+			uint64_t mask = uint64_t(1) << (j & 63);
+			int r = rank();
+			while (r < checkCount && !(rows[size_t(r) * columnWords + word] & mask)) r++;
+			if (r == checkCount) continue;
+
+			uint64_t* pivot = rows.data() + size_t(rank()) * columnWords;
+			swap_ranges(pivot, pivot + columnWords, rows.data() + size_t(r) * columnWords);
+			for (int other = 0; other < checkCount; other++) {
+				uint64_t* row = rows.data() + size_t(other) * columnWords;
+				if (row == pivot || !(row[word] & mask)) continue;
+				for (int w = 0; w < columnWords; w++) {
+					row[w] ^= pivot[w];
+				}
+			}
+			pivotColumns.push_back(j);
+		}
+	}
+
+	//         
+	void collectBasis() {
+		pivotWords = (rank() + 63) / 64;
+		basisIndexOf.assign(positionCount(), 0);
+		pivotReliabilities.resize(rank());
+		for (int r = 0; r < rank(); r++) {
+			basisIndexOf[pivotColumns[r]] = -1;
+			pivotReliabilities[r] = reliabilities[pivotColumns[r]];
+		}
+		basisColumns.clear();
+		for (int j = 0; j < positionCount(); j++) {
+			if (basisIndexOf[j] < 0) continue;
+			basisIndexOf[j] = static_cast<int>(basisColumns.size());
+			basisColumns.push_back(j);
+		}
+
+		basisMasks.assign(basisColumns.size() * pivotWords, 0);
+		for (int r = 0; r < rank(); r++) {
+			const uint64_t* row = rows.data() + size_t(r) * columnWords;
+			for (int w = 0; w < columnWords; w++) {
+				for (uint64_t bits = row[w]; bits; bits &= bits - 1) {
+					int b = basisIndexOf[(w << 6) + __builtin_ctzll(bits)];
+					if (b >= 0) basisMasks[size_t(b) * pivotWords + (r >> 6)] |= uint64_t(1) << (r & 63);
+				}
+			}
+		}
+	}
+
+	//      ;  ,     limit
+	double discrepancy(const uint64_t* difference, double limit) const {
+		double sum = 0;
+		for (int w = 0; w < pivotWords; w++) {
+			for (uint64_t bits = difference[w]; bits; bits &= bits - 1) {
+				sum += pivotReliabilities[(w << 6) + __builtin_ctzll(bits)];
+				if (sum >= limit) return sum;
+			}
+		}
+		return sum;
+	}
+
+	//    depth (    start); cost -   
+	void search(int depth, int start, double cost) {
+		const uint64_t* difference = differences.data() + size_t(depth) * pivotWords;
+		uint64_t* next = differences.data() + size_t(depth + 1) * pivotWords;
+		for (int b = start; b < static_cast<int>(basisColumns.size()); b++) {
+			double flipCost = cost + reliabilities[basisColumns[b]];
+			if (flipCost >= bestMetric) break;
+			const uint64_t* mask = basisMasks.data() + size_t(b) * pivotWords;
+			for (int w = 0; w < pivotWords; w++) {
+				next[w] = difference[w] ^ mask[w];
+			}
+			patternCount++;
+			flips[depth] = b;
+			double metric = flipCost + discrepancy(next, bestMetric - flipCost);
+			if (metric < bestMetric) {
+				bestMetric = metric;
+				bestFlips.assign(flips.begin(), flips.begin() + depth + 1);
+				copy(next, next + pivotWords, bestDifference.begin());
+			}
+			if (depth + 1 < static_cast<int>(flips.size())) search(depth + 1, b + 1, flipCost);
+		}
+	}
+};
+
+//       LDPC
+class VariableNode {
+private:
+	double channelLLR = 0.0; //      
+	bool isFrozen = false; // , ,    ()
+	int frozenBit = 0; //    (0 - LLR `+Inf`, 1 - LLR `-Inf`)
+
+public:
+	//-  :  `+Inf` (  `0`).
+	//- :  `ChannelLLR`.
+
+	//    (   )
+	// bit - ,     (    )
+	void setIsFrozen(bool frozen, int bit = 0) {
+		isFrozen = frozen;
+		frozenBit = bit;
+	}
+
+	//   LLR (Inf   )
+	double calcInitialMessage() const {
+		if (isFrozen) return frozenBit ? -INFINITY : INFINITY;
+		return channelLLR;
+	}
+
+	//       LLR
+	/*
+	1.  `ChannelLLR`    LLR (  ).
+    2.  -    `Inf`,    ( ).
+        :   `+Inf` ( ).
+    checkToVariable -    C2V, edges -   , to -   .
+     */
+	double calcMessage(const double* checkToVariable, const int* edges, int degree, int to) const {
+		if (isFrozen) return calcInitialMessage();
+
+		double sum = channelLLR;
+		for (int k = 0; k < degree; k++) {
+			if (edges[k] == to) continue;
+			double message = checkToVariable[edges[k]];
+			if (isinf(message)) return message;
+			sum += message;
+		}
+		return sum;
+	}
+
+	//   LLR          `ChannelLLR`.
+	double marginalize(const double* checkToVariable, const int* edges, int degree) const {
+		return calcMessage(checkToVariable, edges, degree, -1); // -1     
+	}
+
+	//      LLR (  LLR    (0/1))
+	//   (`0`  `1`); generator -      LLR
+	int estimateSendBit(const double* checkToVariable, const int* edges, int degree, mt19937& generator) const {
+		return hardDecision(marginalize(checkToVariable, edges, degree), generator);
+	}
+
+	//     LLR (   LLR)
+	static int hardDecision(double llr, mt19937& generator) {
+		if (llr > 0) return 0; //  `0`
+		if (llr < 0) return 1; //  `1`
+
+		//     LLR
+		uniform_int_distribution<> dis(0, 1);
+		return dis(generator);
+	}
+
+	//   
+	void clear() {
+		channelLLR = 0.0;
+	}
+
+	//   LLR
+	void setChannelLLR(double llr) {
+		channelLLR = llr;
+	}
+};
+
+#ifdef LDPC_INSTRUMENTATION
+//      (      )
+/*
+1.   :  ,  ,     .
+                ,
+               .
+2.            (TerminationReason).
+3.  C2V:    (  ,    ).
+4.  :      
+   (  0 -   BP, k + 1 -  k).
+5. OSD:    (BP  ),      .
+     merge,    JSON.
+*/
+struct DecoderStatistics {
+	uint64_t decodeCount = 0; //  BP
+	uint64_t convergedCount = 0; // ,   
+	uint64_t iterationLimitCount = 0; // ,     
+	uint64_t terminationCounts[terminationReasonCount] = {}; //    
+	uint64_t iterationCount = 0; //    
+	vector<uint64_t> iterationHistogram; // [i] -     i 
+	uint64_t checkNodeNanoseconds = 0;
+	uint64_t variableNodeNanoseconds = 0;
+	uint64_t syndromeNanoseconds = 0;
+	uint64_t messageCount = 0; //   C2V
+	uint64_t infiniteMessageCount = 0;
+	uint64_t saturatedMessageCount = 0;
+	uint64_t listDecodeCount = 0;
+	uint64_t listUnsatisfiedCount = 0; //       
+	vector<uint64_t> listWinnerHistogram;
+	uint64_t chaseDecodeCount = 0;
+	uint64_t chaseUnsatisfiedCount = 0;
+	vector<uint64_t> chaseWinnerHistogram;
+	uint64_t osdDecodeCount = 0;
+	uint64_t osdPostprocessCount = 0; // ,  BP     OSD
+	uint64_t osdPatternCount = 0; //   OSD
+	uint64_t osdNanoseconds = 0;
+
+	static uint64_t now() {
+		return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	//   start; start     (  )
+	static uint64_t lap(uint64_t& start) {
+		uint64_t previous = start;
+		start = now();
+		return start - previous;
+	}
+
+	static void increment(vector<uint64_t>& histogram, size_t index) {
+		if (histogram.size() <= index) histogram.resize(index + 1, 0);
+		histogram[index]++;
+	}
+
+	void recordDecode(int iterations, TerminationReason reason) {
+		decodeCount++;
+		iterationCount += iterations;
+		terminationCounts[static_cast<int>(reason)]++;
+		if (reason == TerminationReason::Converged) {
+			convergedCount++;
+			increment(iterationHistogram, iterations);
+		}
+		else if (reason == TerminationReason::IterationLimit) {
+			iterationLimitCount++;
+		}
+	}
+
+	//  C2V   ( ); limit -   (INFINITY -  )
+	// multiplicity -  ,    ( min-sum  )
+	void countMessages(const double* messages, int count, double limit, int multiplicity = 1) {
+		messageCount += uint64_t(count) * multiplicity;
+		for (int k = 0; k < count; k++) {
+			if (isinf(messages[k])) infiniteMessageCount += multiplicity;
+			else if (fabs(messages[k]) > limit) saturatedMessageCount += multiplicity;
+		}
+	}
+
+	void merge(const DecoderStatistics& other) {
+		auto mergeHistogram = [](vector<uint64_t>& to, const vector<uint64_t>& from) {
+			if (to.size() < from.size()) to.resize(from.size(), 0);
+			for (size_t i = 0; i < from.size(); i++) to[i] += from[i];
+		};
+		decodeCount += other.decodeCount;
+		convergedCount += other.convergedCount;
+		iterationLimitCount += other.iterationLimitCount;
+		iterationCount += other.iterationCount;
+		for (int i = 0; i < terminationReasonCount; i++) terminationCounts[i] += other.terminationCounts[i];
+		mergeHistogram(iterationHistogram, other.iterationHistogram);
+		checkNodeNanoseconds += other.checkNodeNanoseconds;
+		variableNodeNanoseconds += other.variableNodeNanoseconds;
+		syndromeNanoseconds += other.syndromeNanoseconds;
+		messageCount += other.messageCount;
+		infiniteMessageCount += other.infiniteMessageCount;
+		saturatedMessageCount += other.saturatedMessageCount;
+		listDecodeCount += other.listDecodeCount;
+		listUnsatisfiedCount += other.listUnsatisfiedCount;
+		mergeHistogram(listWinnerHistogram, other.listWinnerHistogram);
+		chaseDecodeCount += other.chaseDecodeCount;
+		chaseUnsatisfiedCount += other.chaseUnsatisfiedCount;
+		mergeHistogram(chaseWinnerHistogram, other.chaseWinnerHistogram);
+		osdDecodeCount += other.osdDecodeCount;
+		osdPostprocessCount += other.osdPostprocessCount;
+		osdPatternCount += other.osdPatternCount;
+		osdNanoseconds += other.osdNanoseconds;
+	}
+
+	string toJson() const {
+		auto histogram = [](const vector<uint64_t>& values) {
+			string text = "[";
+			for (size_t i = 0; i < values.size(); i++) {
+				text += (i ? ", " : "") + to_string(values[i]);
+			}
+			return text + "]";
+		};
+		string terminations = "{";
+		for (int i = 0; i < terminationReasonCount; i++) {
+			terminations += string(i ? ", " : "") + "\"" + terminationReasonName(static_cast<TerminationReason>(i)) + "\": " + to_string(terminationCounts[i]);
+		}
+		terminations += "}";
+		ostringstream out;
+		out << "{\"decodes\": " << decodeCount
+			<< ", \"converged\": " << convergedCount
+			<< ", \"iterationLimit\": " << iterationLimitCount
+			<< ", \"iterations\": " << iterationCount
+			<< ", \"iterationHistogram\": " << histogram(iterationHistogram)
+			<< ", \"terminations\": " << terminations
+			<< ", \"nanoseconds\": {\"checkNode\": " << checkNodeNanoseconds
+			<< ", \"variableNode\": " << variableNodeNanoseconds
+			<< ", \"syndrome\": " << syndromeNanoseconds << "}"
+			<< ", \"messages\": {\"checkToVariable\": " << messageCount
+			<< ", \"infinite\": " << infiniteMessageCount
+			<< ", \"saturated\": " << saturatedMessageCount << "}"
+			<< ", \"list\": {\"decodes\": " << listDecodeCount
+			<< ", \"unsatisfied\": " << listUnsatisfiedCount
+			<< ", \"winnerHistogram\": " << histogram(listWinnerHistogram) << "}"
+			<< ", \"chase\": {\"decodes\": " << chaseDecodeCount
+			<< ", \"unsatisfied\": " << chaseUnsatisfiedCount
+			<< ", \"winnerHistogram\": " << histogram(chaseWinnerHistogram) << "}"
+			<< ", \"osd\": {\"decodes\": " << osdDecodeCount
+			<< ", \"postprocessed\": " << osdPostprocessCount
+			<< ", \"patterns\": " << osdPatternCount
+			<< ", \"nanoseconds\": " << osdNanoseconds << "}}";
+		return out.str();
+	}
+};
+#endif
+
+//    :    LLR   
+//  ,       (    -).
+struct alignas(64) DecodingWorkspace {
+	vector<VariableNode> variableNodes; //   
+	vector<double> checkToVariable; //       (  )
+	vector<double> variableToCheck; //       (  )
+	vector<double> aPosterioriLLRs; //  LLR   ( )
+	vector<double> layerMessages; //  V2C    ( ,  QC- - Z  )
+	vector<double> blockMinimums; //   ,      Z   (QC-)
+	vector<double> floodingLLRs; //  LLR   (  QC-)
+	SyndromeTracker syndrome; //        
+	mt19937 generator; //      LLR ( - LDPCCode::setSeed)
+	int iterationCount = 0; //    
+	TerminationReason terminationReason = TerminationReason::IterationLimit; //    
+	IterationMonitor iterationMonitor; //   
+	vector<pair<int, double>> ambiguousBits; //     LLR   ( K  )
+	vector<pair<double, int>> chaseCandidates; //  :       
+	vector<double> pendingMessages; // Residual BP: C2V,        (  )
+	ResidualQueue residualQueue; // Residual BP:    
+	vector<int> touchedChecks; // Residual BP: ,   V2C   
+	vector<char> isTouched; // Residual BP:   touchedChecks
+	OrderedStatisticsDecoder osd; //  OSD (   )
+#ifdef LDPC_INSTRUMENTATION
+	DecoderStatistics statistics; //   (-   )
+#endif
+};
+
+//        
+/*
+1.          .
+2. parallelFor        ,    .
+3.       ;  ,    .
+4.     ( 0  getWorkerCount() - 1),     .
+*/
+class ThreadPool {
+private:
+	//    [begin, end),    64-  (  CAS)
+	struct alignas(64) WorkRange {
+		atomic<uint64_t> range{ 0 };
+	};
+
+	vector<thread> threads;
+	unique_ptr<WorkRange[]> ranges;
+	mutex stateMutex;
+	mutex submitMutex; //     parallelFor
+	condition_variable wakeCondition;
+	condition_variable doneCondition;
+	const function<void(int, int)>* task = nullptr;
+	int busyThreads = 0;
+	uint64_t generation = 0;
+	bool stopping = false;
+
+	static uint64_t packRange(uint32_t begin, uint32_t end) {
+		return (uint64_t(begin) << 32) | end;
+	}
+
+	//      
+	bool takeOwn(int worker, int& index) {
+		atomic<uint64_t>& range = ranges[worker].range;
+		uint64_t current = range.load();
+		while (true) {
+			uint32_t begin = current >> 32, end = static_cast<uint32_t>(current);
+			if (begin >= end) return false;
+			if (range.compare_exchange_weak(current, packRange(begin + 1, end))) {
+				index = begin;
+				return true;
+			}
+		}
+	}
+
+	// :         
+	bool steal(int worker, int& index) {
+		int workerCount = getWorkerCount();
+		for (int k = 1; k < workerCount; k++) {
+			atomic<uint64_t>& range = ranges[(worker + k) % workerCount].range;
+			uint64_t current = range.load();
+			while (true) {
+				uint32_t begin = current >> 32, end = static_cast<uint32_t>(current);
+				if (begin >= end) break;
+				uint32_t middle = begin + (end - begin) / 2;
+				if (range.compare_exchange_weak(current, packRange(begin, middle))) {
+					ranges[worker].range.store(packRange(middle + 1, end));
+					index = middle;
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	void runTasks(int worker) {
+		int index;
+		while (takeOwn(worker, index) || steal(worker, index)) {
+			(*task)(worker, index);
+		}
+	}
+
+	void workerLoop(int worker) {
+		uint64_t seenGeneration = 0;
+		while (true) {
+			{
+				unique_lock<mutex> lock(stateMutex);
+				wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+				if (stopping) return;
+				seenGeneration = generation;
+			}
+			runTasks(worker);
+			lock_guard<mutex> lock(stateMutex);
+			if (--busyThreads == 0) doneCondition.notify_one();
+		}
+	}
+
+public:
+	// threadCount -    (0 -     )
+	explicit ThreadPool(int threadCount) : ranges(new WorkRange[threadCount + 1]) {
+		for (int i = 0; i < threadCount; i++) {
+			threads.emplace_back(&ThreadPool::workerLoop, this, i);
+		}
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	~ThreadPool() {
+		{
+			lock_guard<mutex> lock(stateMutex);
+			stopping = true;
+		}
+		wakeCondition.notify_all();
+		for (auto& t : threads) t.join();
+	}
+
+	int getWorkerCount() const {
+		return static_cast<int>(threads.size()) + 1;
+	}
+
+	//  function(worker, index)   index  [0, count)   
+	void parallelFor(int count, const function<void(int, int)>& function) {
+		lock_guard<mutex> submit(submitMutex);
+		int workerCount = getWorkerCount();
+		{
+			lock_guard<mutex> lock(stateMutex);
+			task = &function;
+			for (int w = 0; w < workerCount; w++) {
+				ranges[w].range.store(packRange(
+					static_cast<uint32_t>(int64_t(count) * w / workerCount),
+					static_cast<uint32_t>(int64_t(count) * (w + 1) / workerCount)));
+			}
+			busyThreads = static_cast<int>(threads.size());
+			generation++;
+		}
+		wakeCondition.notify_all();
+		runTasks(workerCount - 1);
+
+		unique_lock<mutex> lock(stateMutex);
+		doneCondition.wait(lock, [&] { return busyThreads == 0; });
+		task = nullptr;
+	}
+};
+
+//  LDPC      LDPC
+class LDPCCode {
+private:
+	int codeLength; //     (  )
+	//    (    CSR),    .    
+	//        (tannerGraph),     
+	struct SharedGraph {
+		once_flag built;
+		TannerGraph graph;
+	};
+	shared_ptr<SharedGraph> sharedGraph = make_shared<SharedGraph>();
+	QuasiCyclicLayout quasiCyclic; //      
+	vector<int> informationBitIndexes; //    ( ,    ())
+	vector<int> frozenBitIndexes; //   
+	// ,    :     (    )
+	struct SharedEncoder {
+		once_flag built;
+		SystematicEncoder encoder;
+	};
+	shared_ptr<SharedEncoder> encoder = make_shared<SharedEncoder>();
+	int systematicColumns = 0; //     [0, systematicColumns)
+	vector<uint64_t> codewordWords; //     encode
+	DecodingWorkspace workspace; //   
+	vector<DecodingWorkspace> workerWorkspaces; //    ( ,  )
+	//    :     ,       ,
+	//      (,  )      parallelFor.
+	//     ,     ,   -  
+	// (      );      setThreadCount
+	struct LazyThreadPool {
+		shared_ptr<ThreadPool> pool;
+		int threadCount = 0; //    setThreadCount (0 -  )
+
+		LazyThreadPool() = default;
+		LazyThreadPool(LazyThreadPool&&) = default;
+		LazyThreadPool(const LazyThreadPool& other) : threadCount(other.threadCount > 0 ? other.threadCount : 1) {}
+		LazyThreadPool& operator=(LazyThreadPool&&) = default;
+		LazyThreadPool& operator=(const LazyThreadPool& other) {
+			pool.reset();
+			threadCount = other.threadCount > 0 ? other.threadCount : 1;
+			return *this;
+		}
+	};
+	LazyThreadPool threadPool; //   (   )
+	uint32_t seed = mt19937::default_seed; //    
+	StoppingCriteria stoppingCriteria; //      
+	CheckNodeRule checkNodeRule = CheckNodeRule::SumProduct; //    
+	double normalizationFactor = 0.75; //  alpha   min-sum
+	double offsetFactor = 0.5; //  beta   min-sum
+	DecodingSchedule schedule = DecodingSchedule::Flooding; //   
+	const double layeredMessageLimit = 1e3; //   C2V    ( Inf - Inf)
+	static const int maxChaseListSize = 1 << 16; //     (  -   BP)
+	long long residualBudget = 0; //    residual BP (0 - iterationLimit * edgeCount,   )
+
+	// ,       (       )
+	//        LLR,      .
+	bool isSatisfyAllChecks(const DecodingWorkspace& ws) const {
+		return ws.syndrome.isSatisfied();
+	}
+
+	//  :     -  
+	void startIterations(DecodingWorkspace& ws) const {
+		ws.iterationCount = 0;
+		ws.terminationReason = TerminationReason::IterationLimit;
+		ws.iterationMonitor.reset();
+	}
+
+	//  : ,   , ; true -  
+	bool isIterationFinal(DecodingWorkspace& ws, const atomic<bool>* cancel) const {
+		if (isSatisfyAllChecks(ws)) {
+			ws.terminationReason = TerminationReason::Converged;
+			return true;
+		}
+		if (ws.iterationMonitor.observe(ws.syndrome, stoppingCriteria, ws.terminationReason)) return true;
+		if (cancel && cancel->load(memory_order_relaxed)) {
+			ws.terminationReason = TerminationReason::Cancelled;
+			return true;
+		}
+		return false;
+	}
+
+	// CSR- :        ()
+	//    ,     (  )
+	const TannerGraph& tannerGraph() const {
+		call_once(sharedGraph->built, [this] {
+			TannerGraph graph = TannerGraph::build(codeLength, quasiCyclic.checkCount(), quasiCyclic.expandEdges());
+			sharedGraph->graph = frozenBitIndexes.empty() ? move(graph) : graph.withoutVariables(frozenMask());
+			});
+		return sharedGraph->graph;
+	}
+
+	//      
+	vector<char> frozenMask() const {
+		vector<char> isFrozen(codeLength, 0);
+		for (int index : frozenBitIndexes) {
+			isFrozen[index] = 1;
+		}
+		return isFrozen;
+	}
+
+	//  CSR-  (  :       )
+	void setGraph(TannerGraph graph) {
+		sharedGraph = make_shared<SharedGraph>();
+		call_once(sharedGraph->built, [&] {
+			sharedGraph->graph = move(graph);
+			});
+	}
+
+	int checkCount() const {
+		return quasiCyclic.liftingSize > 0 ? quasiCyclic.checkCount() : tannerGraph().checkCount;
+	}
+
+	int edgeCount() const {
+		return quasiCyclic.liftingSize > 0 ? quasiCyclic.edgeCount() : tannerGraph().edgeCount();
+	}
+
+	//     (,  ): CSR-  ,
+	//  LLR   -  ws.aPosterioriLLRs
+	bool isBlockSchedule() const {
+		return quasiCyclic.liftingSize > 0 && schedule != DecodingSchedule::Residual;
+	}
+
+	//  LLR      C2V
+	double marginalize(const DecodingWorkspace& ws, int variable) const {
+		if (isBlockSchedule()) return ws.aPosterioriLLRs[variable];
+		const TannerGraph& graph = tannerGraph();
+		int begin = graph.variableOffsets[variable];
+		int degree = graph.variableOffsets[variable + 1] - begin;
+		return ws.variableNodes[variable].marginalize(ws.checkToVariable.data(), graph.variableEdges.data() + begin, degree);
+	}
+
+	//         C2V
+	int estimateSendBit(DecodingWorkspace& ws, int variable) const {
+		if (isBlockSchedule()) return VariableNode::hardDecision(ws.aPosterioriLLRs[variable], ws.generator);
+		const TannerGraph& graph = tannerGraph();
+		int begin = graph.variableOffsets[variable];
+		int degree = graph.variableOffsets[variable + 1] - begin;
+		return ws.variableNodes[variable].estimateSendBit(ws.checkToVariable.data(), graph.variableEdges.data() + begin, degree, ws.generator);
+	}
+
+	//        
+	/*
+	1.   -  ,     .
+	2.     :       ,
+	    ( |LLR|  ) -   |LLR|  .
+	3.     ,   ;   
+	        (  -   ).
+	ambiguousBits -   (, LLR),   :    .
+	graph - CSR-      (    CSR).
+	*/
+	template <typename Graph>
+	void selectBestCandidate(DecodingWorkspace& ws, const Graph& graph, const vector<pair<int, double>>& ambiguousBits, int* decoded) {
+		ws.syndrome.reset(codeLength, checkCount());
+		for (int v = 0; v < codeLength; v++) {
+			ws.syndrome.update(graph, v, estimateSendBit(ws, v) ? -1.0 : 1.0);
+		}
+
+		uint64_t candidateCount = uint64_t(1) << ambiguousBits.size();
+		uint64_t candidate = 0, bestCandidate = 0;
+		LDPC_PROFILE(uint64_t bestIndex = 0);
+		double metric = 0, bestMetric = 0;
+		int bestUnsatisfiedCount = ws.syndrome.unsatisfiedCount;
+		for (uint64_t i = 1; i < candidateCount && ws.syndrome.unsatisfiedCount != 0; i++) {
+			int bit = __builtin_ctzll(i);
+			candidate ^= uint64_t(1) << bit;
+			ws.syndrome.flip(graph, ambiguousBits[bit].first);
+			metric += ((candidate >> bit) & 1) ? abs(ambiguousBits[bit].second) : -abs(ambiguousBits[bit].second);
+			if (ws.syndrome.unsatisfiedCount < bestUnsatisfiedCount ||
+				(ws.syndrome.unsatisfiedCount == bestUnsatisfiedCount && metric < bestMetric)) {
+				bestCandidate = candidate;
+				LDPC_PROFILE(bestIndex = i);
+				bestMetric = metric;
+				bestUnsatisfiedCount = ws.syndrome.unsatisfiedCount;
+			}
+		}
+
+		LDPC_PROFILE(ws.statistics.listDecodeCount++);
+		LDPC_PROFILE(ws.statistics.listUnsatisfiedCount += bestUnsatisfiedCount != 0);
+		LDPC_PROFILE(DecoderStatistics::increment(ws.statistics.listWinnerHistogram, bestIndex));
+
+		//    ,     
+		for (size_t bit = 0; bit < ambiguousBits.size(); bit++) {
+			if (((candidate ^ bestCandidate) >> bit) & 1) ws.syndrome.flip(graph, ambiguousBits[bit].first);
+		}
+		for (size_t i = 0; i < informationBitIndexes.size(); i++) {
+			decoded[i] = ws.syndrome.getDecision(informationBitIndexes[i]);
+		}
+	}
+
+	//     (decoded - K )
+	void estimateInformationBits(DecodingWorkspace& ws, int* decoded) const {
+		for (size_t i = 0; i < informationBitIndexes.size(); i++) {
+			decoded[i] = estimateSendBit(ws, informationBitIndexes[i]);
+		}
+	}
+
+	//    LLR,  count -   (  ws.ambiguousBits,   )
+	void selectAmbiguousBits(DecodingWorkspace& ws, int count) const {
+		ws.ambiguousBits.clear();
+		for (int index : informationBitIndexes) {
+			ws.ambiguousBits.emplace_back(index, marginalize(ws, index));
+		}
+		partial_sort(ws.ambiguousBits.begin(), ws.ambiguousBits.begin() + count, ws.ambiguousBits.end(), [](const auto& a, const auto& b) {
+			return abs(a.second) < abs(b.second);
+			});
+		ws.ambiguousBits.resize(count);
+	}
+
+	//   [0, count)    -  |LLR|   ws.ambiguousBits
+	// ( k      k),    -  
+	void rankChaseCandidates(DecodingWorkspace& ws, int count) const {
+		ws.chaseCandidates.resize(count);
+		ws.chaseCandidates[0] = { 0.0, 0 };
+		for (int candidate = 1; candidate < count; candidate++) {
+			int bit = __builtin_ctz(candidate);
+			ws.chaseCandidates[candidate] = { ws.chaseCandidates[candidate & (candidate - 1)].first + abs(ws.ambiguousBits[bit].second), candidate };
+		}
+		sort(ws.chaseCandidates.begin(), ws.chaseCandidates.end());
+	}
+
+	//    C2V     
+	void calcCheckMessages(const double* incoming, double* outgoing, int degree) const {
+		switch (checkNodeRule) {
+		case CheckNodeRule::SumProduct:
+			CheckNode::calcSumProductMessages(incoming, outgoing, degree);
+			break;
+		case CheckNodeRule::MinSum:
+			CheckNode::calcMinSumMessages(incoming, outgoing, degree, 1.0, 0.0);
+			break;
+		case CheckNodeRule::NormalizedMinSum:
+			CheckNode::calcMinSumMessages(incoming, outgoing, degree, normalizationFactor, 0.0);
+			break;
+		case CheckNodeRule::OffsetMinSum:
+			CheckNode::calcMinSumMessages(incoming, outgoing, degree, 1.0, offsetFactor);
+			break;
+		}
+	}
+
+	//    
+	// channelOutputs - codeLength  LLR
+	void executeMessagePassing(DecodingWorkspace& ws, const double* channelOutputs) {
+		//      `ChannelLLR`
+		for (int i = 0; i < codeLength; i++) {
+			ws.variableNodes[i].setChannelLLR(channelOutputs[i]);
+		}
+		executeSchedule(ws, nullptr);
+	}
 
-public:
-	double calcMessage(int to) //       tanh/atanh
-	{
-		double product = 1.0;
-		for (const auto& [index, message] : receivedMessage) {
-			if (index == to) continue;
-			if (isinf(message) {
-				if (message < 0) product *= -1;
-				continue;
-			}
-			product *= tanh(message / 2);
+	//      (    )
+	void prepareWorkerWorkspaces() {
+		if (!threadPool.pool) {
+			int threadCount = threadPool.threadCount > 0 ? threadPool.threadCount : static_cast<int>(thread::hardware_concurrency());
+			threadPool.pool = make_shared<ThreadPool>(max(1, threadCount) - 1);
+		}
+		while (static_cast<int>(workerWorkspaces.size()) < threadPool.pool->getWorkerCount()) {
+			workerWorkspaces.push_back(workspace);
+			seedWorker(workerWorkspaces.back(), static_cast<int>(workerWorkspaces.size()));
+			LDPC_PROFILE(workerWorkspaces.back().statistics = DecoderStatistics());
 		}
-		return 2 * atanh(product);
 	}
 
-	//   (   ())
-	void receiveMessage(int from, double message) {
-		receivedMessage[from] = message;
+	//   worker ( 1)       ;
+	//   -1 - c    c  
+	void seedWorker(DecodingWorkspace& ws, int worker) const {
+		seed_seq sequence{ seed, static_cast<uint32_t>(worker) };
+		ws.generator.seed(sequence);
 	}
 
-	//    
-	void clear() {
-		receivedMessage.clear();
+	//   ; cancel -    (   )
+	void executeSchedule(DecodingWorkspace& ws, const atomic<bool>* cancel) {
+		if (quasiCyclic.liftingSize > 0 && schedule != DecodingSchedule::Residual) {
+			executeQuasiCyclicSchedule(ws, cancel);
+		}
+		else if (schedule == DecodingSchedule::Layered) {
+			executeLayeredSchedule(ws, cancel);
+		}
+		else if (schedule == DecodingSchedule::Residual) {
+			executeResidualSchedule(ws, cancel);
+		}
+		else {
+			executeFloodingSchedule(ws, cancel);
+		}
+		LDPC_PROFILE(ws.statistics.recordDecode(ws.iterationCount, ws.terminationReason));
 	}
-};
 
-//        
-struct Edge {
-	int variableNodeIndex; //   ,   .
-	int checkNodeIndex; //    (),   .
-};
+	//  :      ,    
+	void executeFloodingSchedule(DecodingWorkspace& ws, const atomic<bool>* cancel) {
+		const TannerGraph& graph = tannerGraph();
+		//   :       .
+		for (int e = 0; e < graph.edgeCount(); e++) {
+			ws.variableToCheck[e] = ws.variableNodes[graph.edgeVariables[e]].calcInitialMessage();
+		}
 
-//       LDPC
-class VariableNode {
-private:
-	double channelLLR = 0.0; //      
-	map<int, double> receivedMessage; // ,       ( )
-	bool isFrozen = false; // , ,    ()
+		ws.syndrome.reset(codeLength, graph.checkCount);
+		startIterations(ws);
 
-public:
-	//-  :  `+Inf` (  `0`).
-	//- :  `ChannelLLR`.
+		//    
+		for (int iter = 0; iter < stoppingCriteria.iterationLimit; iter++) {
+			LDPC_PROFILE(uint64_t phaseStart = DecoderStatistics::now());
+			//         .
+			for (int c = 0; c < graph.checkCount; c++) {
+				int begin = graph.checkOffsets[c];
+				calcCheckMessages(ws.variableToCheck.data() + begin, ws.checkToVariable.data() + begin, graph.checkOffsets[c + 1] - begin);
+				LDPC_PROFILE(ws.statistics.countMessages(ws.checkToVariable.data() + begin, graph.checkOffsets[c + 1] - begin, INFINITY));
+			}
+			LDPC_PROFILE(ws.statistics.checkNodeNanoseconds += DecoderStatistics::lap(phaseStart));
 
-	//    (   )
-	void setIsFrozen(bool frozen) {
-		isFrozen = frozen;
-	}
+			//       .
+			for (int v = 0; v < codeLength; v++) {
+				const int* variableEdges = graph.variableEdges.data() + graph.variableOffsets[v];
+				int degree = graph.variableOffsets[v + 1] - graph.variableOffsets[v];
+				for (int k = 0; k < degree; k++) {
+					ws.variableToCheck[variableEdges[k]] = ws.variableNodes[v].calcMessage(ws.checkToVariable.data(), variableEdges, degree, variableEdges[k]);
+				}
+				ws.syndrome.update(graph, v, ws.variableNodes[v].marginalize(ws.checkToVariable.data(), variableEdges, degree));
+			}
+			LDPC_PROFILE(ws.statistics.variableNodeNanoseconds += DecoderStatistics::lap(phaseStart));
 
-	//   LLR (Inf   )
-	double calcInitialMessage() {
-		if (isFrozen) return INFINITY;
-		return channelLLR;
+			//  :       
+			ws.iterationCount = iter + 1;
+			bool finished = isIterationFinal(ws, cancel);
+			LDPC_PROFILE(ws.statistics.syndromeNanoseconds += DecoderStatistics::lap(phaseStart));
+			if (finished) break;
+		}
 	}
 
-	//       LLR
+	//  :     
 	/*
-	1.  `ChannelLLR`    LLR (  ).
-    2.  -    `Inf`,    ( ).
-        :   `+Inf` ( ).
-     */
-	double calcMessage(int to) {
-		if (isFrozen) return INFINITY;
-
-		double sum = channelLLR;
-		for (const auto& [index, message] : receivedMessage) {
-			if (index == to) continue;
-			if (isinf(message)) return message;
-			sum += message;
+	1.  V2C    C2V   LLR (  V2C  ).
+	2.  C2V     LLR,      .
+	3.     LLR `+Inf`   .
+	*/
+	void executeLayeredSchedule(DecodingWorkspace& ws, const atomic<bool>* cancel) {
+		const TannerGraph& graph = tannerGraph();
+		for (int v = 0; v < codeLength; v++) {
+			ws.aPosterioriLLRs[v] = ws.variableNodes[v].calcInitialMessage();
 		}
-		return sum;
-	}
+		fill(ws.checkToVariable.begin(), ws.checkToVariable.end(), 0.0);
+		ws.syndrome.reset(codeLength, graph.checkCount);
+		startIterations(ws);
 
-	//   
-	void receiveMessage(int from, double message) {
-		receivedMessage[from] = message;
-	}
+		for (int iter = 0; iter < stoppingCriteria.iterationLimit; iter++) {
+			LDPC_PROFILE(uint64_t phaseStart = DecoderStatistics::now());
+			for (int c = 0; c < graph.checkCount; c++) {
+				int begin = graph.checkOffsets[c];
+				int degree = graph.checkOffsets[c + 1] - begin;
+				const int* variables = graph.edgeVariables.data() + begin;
+				double* messages = ws.checkToVariable.data() + begin;
 
-	//   LLR          `ChannelLLR`.
-	double marginalize() {
-		return calcMessage(-1); // -1     
-	}
+				for (int k = 0; k < degree; k++) {
+					double llr = ws.aPosterioriLLRs[variables[k]];
+					ws.layerMessages[k] = isinf(llr) ? llr : llr - messages[k];
+				}
 
-	//      LLR (  LLR    (0/1))
-	//   (`0`  `1`)
-	int estimateSendBit() {
-		double llr = marginalize();
-		if (llr > 0) return 0; //  `0`
-		if (llr < 0) return 1; //  `1`
+				calcCheckMessages(ws.layerMessages.data(), messages, degree);
+				LDPC_PROFILE(ws.statistics.countMessages(messages, degree, layeredMessageLimit));
 
-		//     LLR
-		static random_device rd;
-		static mt19937 gen(rd());
-		uniform_int_distribution<> dis(0, 1);
-		return dis(gen);
-	}
+				for (int k = 0; k < degree; k++) {
+					messages[k] = clamp(messages[k], -layeredMessageLimit, layeredMessageLimit);
+					double& llr = ws.aPosterioriLLRs[variables[k]];
+					if (!isinf(llr)) llr = ws.layerMessages[k] + messages[k];
+				}
+			}
 
-	//   
-	void clear() {
-		channelLLR = 0.0;
-		receivedMessage.clear();
-	}
+			LDPC_PROFILE(ws.statistics.checkNodeNanoseconds += DecoderStatistics::lap(phaseStart));
+			for (int v = 0; v < codeLength; v++) {
+				ws.syndrome.update(graph, v, ws.aPosterioriLLRs[v]);
+			}
 
-	//   LLR
-	void setChannelLLR(double llr) {
-		channelLLR = llr;
+			//  :       
+			ws.iterationCount = iter + 1;
+			bool finished = isIterationFinal(ws, cancel);
+			LDPC_PROFILE(ws.statistics.syndromeNanoseconds += DecoderStatistics::lap(phaseStart));
+			if (finished) break;
+		}
 	}
-};
 
-//  LDPC      LDPC
-class LDPCCode {
-private:
-	int codeLength; //     (  )
-	vector<Edge> edges; //    (  ,       .)
-	vector<int> informationBitIndexes; //    ( ,    ())
-	vector<int> frozenBitIndexes; //   
-	vector<VariableNode> variableNodes; //   
-	vector<CheckNode> checkNodes; //   
-	const int decodeIteration = 40; // - 
+	//  C2V     V2C  ws.pendingMessages;   ( )
+	double calcPendingMessages(DecodingWorkspace& ws, int check) const {
+		const TannerGraph& graph = tannerGraph();
+		int begin = graph.checkOffsets[check];
+		int degree = graph.checkOffsets[check + 1] - begin;
+		const double* committed = ws.checkToVariable.data() + begin;
+		double* pending = ws.pendingMessages.data() + begin;
+		calcCheckMessages(ws.variableToCheck.data() + begin, pending, degree);
 
-	// ,       (       )
+		double residual = 0;
+		for (int k = 0; k < degree; k++) {
+			if (pending[k] != committed[k]) residual = max(residual, fabs(pending[k] - committed[k]));
+		}
+		return residual;
+	}
+
+	//   ( residual BP)
 	/*
-	1.         `Marginalize()`.
-    2.  ,      (  2).
-    3.  `true`,      `0` ().
+	1.       C2V,     ,   -
+	       ;      max-.
+	2. :       C2V (degree  ),  
+	    V2C       LLR (  ).
+	3.     :    ,      .
+	4. :   ,     (residualBudget)
+	      . iterationCount -        ,
+	    StoppingCriteria      .
 	*/
-	bool isSatisfyAllChecks() {
-		vector<int> estimates(codeLength);
-		for (int i = 0; i < codeLength; i++) {
-			double llr = variableNodes[i].marginalize();
-			if (llr == 0) return false;
-			estimates[i] = (llr < 0) ? 1 : 0;
+	void executeResidualSchedule(DecodingWorkspace& ws, const atomic<bool>* cancel) {
+		const TannerGraph& graph = tannerGraph();
+		const int edgeCount = graph.edgeCount();
+		const long long budget = residualBudget > 0 ? residualBudget : static_cast<long long>(stoppingCriteria.iterationLimit) * edgeCount;
+		if (ws.pendingMessages.size() != static_cast<size_t>(edgeCount)) {
+			ws.pendingMessages.assign(edgeCount, 0.0);
+			ws.isTouched.assign(graph.checkCount, 0);
+			ws.touchedChecks.reserve(graph.checkCount);
 		}
 
-		vector<int> checks(checkNodes.size(), 0);
-		for (const auto& edge : edges) {
-			checks[edge.checkNodeIndex] += estimates[edge.variableNodeIndex];
+		for (int e = 0; e < edgeCount; e++) {
+			ws.variableToCheck[e] = ws.variableNodes[graph.edgeVariables[e]].calcInitialMessage();
+		}
+		fill(ws.checkToVariable.begin(), ws.checkToVariable.end(), 0.0);
+		ws.syndrome.reset(codeLength, graph.checkCount);
+		for (int v = 0; v < codeLength; v++) {
+			ws.syndrome.update(graph, v, ws.variableNodes[v].calcInitialMessage());
 		}
+		ws.residualQueue.reset(graph.checkCount);
+		for (int c = 0; c < graph.checkCount; c++) {
+			ws.residualQueue.update(c, calcPendingMessages(ws, c));
+		}
+
+		startIterations(ws);
+		long long updates = 0;
+		long long nextIteration = edgeCount;
+		while (updates < budget) {
+			if (isSatisfyAllChecks(ws)) {
+				ws.terminationReason = TerminationReason::Converged;
+				break;
+			}
+			if (ws.residualQueue.empty() || ws.residualQueue.topResidual() == 0) {
+				ws.terminationReason = TerminationReason::Stagnation;
+				break;
+			}
+			int check = ws.residualQueue.pop();
+			int begin = graph.checkOffsets[check];
+			int end = graph.checkOffsets[check + 1];
+			copy(ws.pendingMessages.begin() + begin, ws.pendingMessages.begin() + end, ws.checkToVariable.begin() + begin);
+			LDPC_PROFILE(ws.statistics.countMessages(ws.checkToVariable.data() + begin, end - begin, INFINITY));
+			updates += end - begin;
 
-		for (int c : checks) {
-			if (c % 2 != 0) return false;
+			//  : V2C      LLR
+			for (int e = begin; e < end; e++) {
+				int v = graph.edgeVariables[e];
+				const int* variableEdges = graph.variableEdges.data() + graph.variableOffsets[v];
+				int degree = graph.variableOffsets[v + 1] - graph.variableOffsets[v];
+				for (int k = 0; k < degree; k++) {
+					int edge = variableEdges[k];
+					if (edge == e) continue;
+					ws.variableToCheck[edge] = ws.variableNodes[v].calcMessage(ws.checkToVariable.data(), variableEdges, degree, edge);
+					int touched = graph.edgeChecks[edge];
+					if (!ws.isTouched[touched]) {
+						ws.isTouched[touched] = 1;
+						ws.touchedChecks.push_back(touched);
+					}
+				}
+				ws.syndrome.update(graph, v, ws.variableNodes[v].marginalize(ws.checkToVariable.data(), variableEdges, degree));
+			}
+
+			//  V2C    :   C2V   
+			for (int touched : ws.touchedChecks) {
+				ws.isTouched[touched] = 0;
+				ws.residualQueue.update(touched, calcPendingMessages(ws, touched));
+			}
+			ws.touchedChecks.clear();
+
+			//    :     ( -   )
+			if (updates >= nextIteration) {
+				nextIteration += edgeCount;
+				if (!isSatisfyAllChecks(ws) && isIterationFinal(ws, cancel)) break;
+			}
 		}
-		return true;
+		if (ws.terminationReason == TerminationReason::IterationLimit && isSatisfyAllChecks(ws)) {
+			ws.terminationReason = TerminationReason::Converged;
+		}
+		ws.iterationCount = static_cast<int>((updates + edgeCount - 1) / max(edgeCount, 1));
 	}
 
-	//    
-	void executeMessagePassing(const vector<double>& channelOutputs) {
-		//      `ChannelLLR`
-		for (int i = 0; i < codeLength; i++) {
-			variableNodes[i].setChannelLLR(channelOutputs[i]);
-		}
+	//    :  -    (Z  )
+	/*
+	1.         ,   ;
+	            (  min-sum,   SPA).
+	2.  LLR        ,   
+	      Z    .
+	3. SPA -      ,   CheckNode::calcSumProductMessages,   :
+	   tanh(m / 2)       ,   -    C2V.
+	4.  : V2C      LLR   (  floodingLLRs),
+	     LLR -     C2V. C2V    layeredMessageLimit,
+	       (     C2V  ).
+	5. C2V     [][z]   V2C (     ), 
+	   LLR   aPosterioriLLRs;     , CSR-  .
+	*/
+	void executeQuasiCyclicSchedule(DecodingWorkspace& ws, const atomic<bool>* cancel) {
+		const int Z = quasiCyclic.liftingSize;
+		const bool flooding = schedule == DecodingSchedule::Flooding;
+		const bool sumProduct = checkNodeRule == CheckNodeRule::SumProduct;
+		const double scale = checkNodeRule == CheckNodeRule::NormalizedMinSum ? normalizationFactor : 1.0;
+		const double offset = checkNodeRule == CheckNodeRule::OffsetMinSum ? offsetFactor : 0.0;
+		double* blockMessages = ws.variableToCheck.data();
+		double* halfTangents = ws.layerMessages.data() + static_cast<size_t>(quasiCyclic.maxRowDegree()) * Z;
+		double* min1 = ws.blockMinimums.data();
+		double* min2 = min1 + Z;
+		double* minIndex = min2 + Z;
+		double* negative = minIndex + Z;
+		double* suffix = min1; // SPA:  tanh   
+		double* prefix = min2; // SPA:  tanh   
 
-		//   :       .
-		for (int i = 0; i < edges.size(); i++) {
-			const auto& edge = edges[i];
-			double message = variableNodes[edge.variableNodeIndex].calcInitialMessage();
-			checkNodes[edge.checkNodeIndex].receiveMessage(i, message);
+		for (int v = 0; v < codeLength; v++) {
+			ws.aPosterioriLLRs[v] = ws.variableNodes[v].calcInitialMessage();
 		}
+		fill(ws.variableToCheck.begin(), ws.variableToCheck.end(), 0.0);
+		ws.syndrome.reset(codeLength, quasiCyclic.checkCount());
+		startIterations(ws);
 
-		//    
-		for (int iter = 0; iter < decodeIteration; iter++) {
-			//         .
-			for (int i = 0; i < edges.size(); i++) {
-				const auto& edge = edges[i];
-				double message = checkNodes[edge.checkNodeIndex].calcMessage(i);
-				variableNodes[edge.variableNodeIndex].receiveMessage(i, message);
+		for (int iter = 0; iter < stoppingCriteria.iterationLimit; iter++) {
+			LDPC_PROFILE(uint64_t phaseStart = DecoderStatistics::now());
+			const double* sourceLLRs = ws.aPosterioriLLRs.data();
+			if (flooding) {
+				copy(ws.aPosterioriLLRs.begin(), ws.aPosterioriLLRs.end(), ws.floodingLLRs.begin());
+				sourceLLRs = ws.floodingLLRs.data();
+				for (int v = 0; v < codeLength; v++) {
+					ws.aPosterioriLLRs[v] = ws.variableNodes[v].calcInitialMessage();
+				}
 			}
 
-			//       .
-			for (int i = 0; i < edges.size(); i++) {
-				const auto& edge = edges[i];
-				double message = variableNodes[edge.variableNodeIndex].calcMessage(i);
-				checkNodes[edge.checkNodeIndex].receiveMessage(i, message);
+			for (int row = 0; row < quasiCyclic.rowCount(); row++) {
+				int first = quasiCyclic.rowOffsets[row];
+				int degree = quasiCyclic.rowOffsets[row + 1] - first;
+				fill(min1, min2 + Z, INFINITY);
+				fill(minIndex, negative + Z, 0.0);
+
+				//  V2C :  z    (z + shift) mod Z 
+				for (int k = 0; k < degree; k++) {
+					const double* llrs = sourceLLRs + quasiCyclic.blockColumns[first + k] * Z;
+					const double* messages = blockMessages + static_cast<size_t>(first + k) * Z;
+					double* extrinsic = ws.layerMessages.data() + k * Z;
+					int shift = quasiCyclic.blockShifts[first + k];
+					copy(llrs + shift, llrs + Z, extrinsic);
+					copy(llrs, llrs + shift, extrinsic + Z - shift);
+
+					if (sumProduct) {
+						double* tangents = halfTangents + k * Z;
+						for (int z = 0; z < Z; z++) {
+							double llr = extrinsic[z];
+							extrinsic[z] = isinf(llr) ? llr : llr - messages[z];
+							tangents[z] = CheckNode::tanhHalf(extrinsic[z]);
+						}
+						continue;
+					}
+
+					//   ;        
+					const double position = k;
+#pragma GCC ivdep
+					for (int z = 0; z < Z; z++) {
+						double llr = extrinsic[z], first1 = min1[z], first2 = min2[z], index = minIndex[z];
+						double message = isinf(llr) ? llr : llr - messages[z];
+						double magnitude = fabs(message);
+						bool smallest = magnitude < first1;
+						extrinsic[z] = message;
+						negative[z] = fabs(negative[z] - (message < 0));
+						min2[z] = smallest ? first1 : min(first2, magnitude);
+						min1[z] = smallest ? magnitude : first1;
+						minIndex[z] = smallest ? position : index;
+					}
+				}
+
+				if (sumProduct) {
+					//  : C2V     
+					fill(suffix, suffix + Z, 1.0);
+					fill(prefix, prefix + Z, 1.0);
+					for (int k = degree - 1; k >= 0; k--) {
+						double* messages = blockMessages + static_cast<size_t>(first + k) * Z;
+						const double* tangents = halfTangents + k * Z;
+						for (int z = 0; z < Z; z++) {
+							messages[z] = suffix[z];
+							suffix[z] *= tangents[z];
+						}
+					}
+				}
+				else {
+					for (int z = 0; z < Z; z++) {
+						min1[z] = max(scale * min1[z] - offset, 0.0);
+						min2[z] = max(scale * min2[z] - offset, 0.0);
+					}
+					//  min2    , min1 -  degree - 1
+					LDPC_PROFILE(ws.statistics.countMessages(min1, Z, layeredMessageLimit, degree - 1));
+					LDPC_PROFILE(ws.statistics.countMessages(min2, Z, layeredMessageLimit));
+				}
+
+				//  C2V   LLR,  
+				for (int k = 0; k < degree; k++) {
+					double* llrs = ws.aPosterioriLLRs.data() + quasiCyclic.blockColumns[first + k] * Z;
+					double* messages = blockMessages + static_cast<size_t>(first + k) * Z;
+					double* extrinsic = ws.layerMessages.data() + k * Z;
+					int shift = quasiCyclic.blockShifts[first + k];
+
+					if (sumProduct) {
+						//  :     
+						const double* tangents = halfTangents + k * Z;
+						for (int z = 0; z < Z; z++) {
+							double product = prefix[z] * messages[z];
+							prefix[z] *= tangents[z];
+							messages[z] = 2 * atanh(product);
+						}
+						LDPC_PROFILE(ws.statistics.countMessages(messages, Z, layeredMessageLimit));
+						for (int z = 0; z < Z; z++) {
+							messages[z] = clamp(messages[z], -layeredMessageLimit, layeredMessageLimit);
+						}
+					}
+					else {
+#pragma GCC ivdep
+						for (int z = 0; z < Z; z++) {
+							double llr = extrinsic[z], first1 = min1[z], first2 = min2[z];
+							double magnitude = min((minIndex[z] == k) ? first2 : first1, layeredMessageLimit);
+							bool sign = (negative[z] != 0) != (llr < 0);
+							messages[z] = sign ? -magnitude : magnitude;
+						}
+					}
+
+					if (flooding) {
+						//  C2V :   z    (z + shift) mod Z
+						for (int z = 0; z < Z - shift; z++) {
+							llrs[shift + z] += messages[z];
+						}
+						for (int z = Z - shift; z < Z; z++) {
+							llrs[z - (Z - shift)] += messages[z];
+						}
+						continue;
+					}
+					for (int z = 0; z < Z; z++) {
+						double llr = extrinsic[z];
+						extrinsic[z] = isinf(llr) ? llr : llr + messages[z];
+					}
+					copy(extrinsic, extrinsic + Z - shift, llrs + shift);
+					copy(extrinsic + Z - shift, extrinsic + Z, llrs);
+				}
 			}
 
-			//  ,     
-			if (isSatisfyAllChecks()) break;
+			LDPC_PROFILE(ws.statistics.checkNodeNanoseconds += DecoderStatistics::lap(phaseStart));
+			for (int v = 0; v < codeLength; v++) {
+				ws.syndrome.update(quasiCyclic, v, ws.aPosterioriLLRs[v]);
+			}
+
+			//  :       
+			ws.iterationCount = iter + 1;
+			bool finished = isIterationFinal(ws, cancel);
+			LDPC_PROFILE(ws.statistics.syndromeNanoseconds += DecoderStatistics::lap(phaseStart));
+			if (finished) break;
 		}
 	}
 
 public:
 	//      (   ( `EstimateSendBit()`)    .)
 	vector<int> decode(const vector<double>& channelOutputs) {
-		executeMessagePassing(channelOutputs);
-		vector<int> decoded;
-		for (int index : informationBitIndexes) {
-			decoded.push_back(variableNodes[index].estimateSendBit());
-		}
+		vector<int> decoded(informationBitIndexes.size());
+		decode(channelOutputs.data(), decoded.data());
 		return decoded;
 	}
 
-	//      (   -   .)
+	//    : codeLength  LLR -> K  
+	//      ,     .
+	void decode(const double* channelOutputs, int* decoded) {
+		executeMessagePassing(workspace, channelOutputs);
+		estimateInformationBits(workspace, decoded);
+	}
+
+	// : K   (0/1   informationBitIndexes) ->    codeLength
+	//   - ,     .
+	vector<int> encode(const vector<int>& informationBits) {
+		if (informationBits.size() != informationBitIndexes.size()) {
+			throw invalid_argument("Information word does not match the code dimension");
+		}
+		vector<int> codeword(codeLength);
+		encode(informationBits.data(), codeword.data());
+		return codeword;
+	}
+
+	//     (     )
+	//     -    (   ).
+	void encode(const int* informationBits, int* codeword) {
+		const SystematicEncoder& systematicEncoder = getEncoder();
+		codewordWords.resize(systematicEncoder.wordCount);
+		fill(codewordWords.begin(), codewordWords.end(), 0);
+		for (size_t i = 0; i < informationBitIndexes.size(); i++) {
+			if (informationBits[i] & 1) SystematicEncoder::flipBit(codewordWords.data(), informationBitIndexes[i]);
+		}
+		systematicEncoder.encode(codewordWords.data());
+		for (int v = 0; v < codeLength; v++) {
+			codeword[v] = SystematicEncoder::getBit(codewordWords.data(), v);
+		}
+	}
+
+	//   ( ,   ,   )
+	//        ,     .
+	//        CSR- (   ).
+	const SystematicEncoder& getEncoder() const {
+		call_once(encoder->built, [this] {
+			encoder->encoder = quasiCyclic.liftingSize > 0
+				? SystematicEncoder::build(TannerGraph::build(codeLength, quasiCyclic.checkCount(), quasiCyclic.expandEdges()), systematicColumns)
+				: SystematicEncoder::build(tannerGraph(), systematicColumns);
+			});
+		return encoder->encoder;
+	}
+
+	//      (  -   .)
 	//      LLR      .
-	vector<vector<int>> listDecode(const vector<double>& channelOutputs, int listSize) {
+	vector<int> listDecode(const vector<double>& channelOutputs, int listSize) {
+		vector<int> decoded(informationBitIndexes.size());
+		listDecode(channelOutputs.data(), listSize, decoded.data());
+		return decoded;
+	}
+
+	//      (  )
+	void listDecode(const double* channelOutputs, int listSize, int* decoded) {
+		if (listSize < 1) {
+			throw invalid_argument("List size must be positive");
+		}
 		//     (  `0` LLR)   .
-		executeMessagePassing(channelOutputs);
-		//   `listSize`,    .
-		int ambiguousBitCount = floor(log2(listSize));
-		vector<pair<int, double>> llrs;
-		for (int index : informationBitIndexes) {
-			double llr = variableNodes[index].marginalize();
-			llrs.emplace_back(index, llr);
+		executeMessagePassing(workspace, channelOutputs);
+		//  `listSize`:    .
+		int ambiguousBitCount = min<int>({ (int)floor(log2(listSize)), (int)informationBitIndexes.size(), 63 });
+		selectAmbiguousBits(workspace, ambiguousBitCount);
+
+		//   ,    (   ).
+		if (isBlockSchedule()) {
+			selectBestCandidate(workspace, quasiCyclic, workspace.ambiguousBits, decoded);
 		}
-		//    LLR (  )
-		sort(llrs.begin(), llrs.end(), [](const auto& a, const auto& b) {
-			return abs(a.second) < abs(b.second);
-			});
+		else {
+			selectBestCandidate(workspace, tannerGraph(), workspace.ambiguousBits, decoded);
+		}
+	}
 
-		//    
-		vector<int> uniqueDecoded;
-		for (int index : informationBitIndexes) {
-			uniqueDecoded.push_back(variableNodes[index].estimateSendBit());
+	//   : BP     
+	/*
+	1.   BP;    ,    .
+	2. log2(listSize)        (LLR `Inf`),
+	    -     ;     ( |LLR|
+	    ,   -   ).
+	3.      ,      ,
+	           .
+	4.  -         ( 
+	        );    -    
+	     (  -   ).      .
+	    maxChaseListSize.
+	*/
+	vector<int> chaseDecode(const vector<double>& channelOutputs, int listSize) {
+		vector<int> decoded(informationBitIndexes.size());
+		chaseDecode(channelOutputs.data(), listSize, decoded.data());
+		return decoded;
+	}
+
+	//      
+	void chaseDecode(const double* channelOutputs, int listSize, int* decoded) {
+		if (listSize < 1 || listSize > maxChaseListSize) {
+			throw invalid_argument("Chase list size must be in [1, " + to_string(maxChaseListSize) + "]");
+		}
+		executeMessagePassing(workspace, channelOutputs);
+		estimateInformationBits(workspace, decoded);
+		LDPC_PROFILE(workspace.statistics.chaseDecodeCount++);
+		if (isSatisfyAllChecks(workspace)) {
+			LDPC_PROFILE(DecoderStatistics::increment(workspace.statistics.chaseWinnerHistogram, 0));
+			return;
+		}
+
+		int ambiguousBitCount = min<int>((int)floor(log2(listSize)), (int)informationBitIndexes.size());
+		if (ambiguousBitCount == 0) {
+			LDPC_PROFILE(workspace.statistics.chaseUnsatisfiedCount++);
+			return;
 		}
+		selectAmbiguousBits(workspace, ambiguousBitCount);
+		rankChaseCandidates(workspace, 1 << ambiguousBitCount);
 
-		vector<vector<int>> listDecoded = { uniqueDecoded };
+		prepareWorkerWorkspaces();
+
+		//   :    this    ,
+		//  function  parallelFor     .
+		// running[w] -    w, cancelled[w] -   
+		int workerCount = threadPool.pool->getWorkerCount();
+		struct ChaseState {
+			mutex resultMutex;
+			int satisfiedRank = INT32_MAX;
+			int bestRank = -1;
+			int bestUnsatisfiedCount;
+			int* decoded;
+			vector<int> running;
+			vector<atomic<bool>> cancelled;
+			LDPC_PROFILE(int winner = 0;)
+		} state;
+		state.bestUnsatisfiedCount = workspace.syndrome.unsatisfiedCount;
+		state.decoded = decoded;
+		state.running.assign(workerCount, INT32_MAX);
+		state.cancelled = vector<atomic<bool>>(workerCount);
+		threadPool.pool->parallelFor(1 << ambiguousBitCount, [this, &state](int worker, int rank) {
+			{
+				lock_guard<mutex> lock(state.resultMutex);
+				if (rank > state.satisfiedRank) return;
+				state.running[worker] = rank;
+				state.cancelled[worker].store(false, memory_order_relaxed);
+			}
+			const vector<pair<int, double>>& llrs = workspace.ambiguousBits;
+			int candidate = workspace.chaseCandidates[rank].second;
+			DecodingWorkspace& ws = workerWorkspaces[worker];
+			ws.variableNodes = workspace.variableNodes;
+			for (size_t bit = 0; bit < llrs.size(); bit++) {
+				ws.variableNodes[llrs[bit].first].setIsFrozen(true, (llrs[bit].second < 0) ^ ((candidate >> bit) & 1));
+			}
+			seedWorker(ws, -1 - candidate);
+			executeSchedule(ws, &state.cancelled[worker]);
+			{
+				lock_guard<mutex> lock(state.resultMutex);
+				state.running[worker] = INT32_MAX;
+				//         
+				bool better = ws.terminationReason != TerminationReason::Cancelled && (isSatisfyAllChecks(ws)
+					? rank < state.satisfiedRank
+					: state.satisfiedRank == INT32_MAX && (ws.syndrome.unsatisfiedCount < state.bestUnsatisfiedCount ||
+						(ws.syndrome.unsatisfiedCount == state.bestUnsatisfiedCount && rank < state.bestRank)));
+				if (better) {
+					state.bestUnsatisfiedCount = ws.syndrome.unsatisfiedCount;
+					state.bestRank = rank;
+					estimateInformationBits(ws, state.decoded);
+					LDPC_PROFILE(state.winner = candidate + 1);
+				}
+				if (better && isSatisfyAllChecks(ws)) {
+					state.satisfiedRank = rank;
+					for (size_t w = 0; w < state.running.size(); w++) {
+						if (state.running[w] > rank) state.cancelled[w].store(true, memory_order_relaxed);
+					}
+				}
+			}
 
-		//    ,     .
-		for (int i = 0; i < ambiguousBitCount; i++) {
-			auto [index, _] = llrs[i];
-			vector<vector<int>> temp;
-			for (const auto& v : listDecoded) {
-				vector<int> inverted = v;
-				inverted[index] = 1 - inverted[index];
-				temp.push_back(inverted);
+			//      :  
+			for (size_t bit = 0; bit < llrs.size(); bit++) {
+				ws.variableNodes[llrs[bit].first].setIsFrozen(false);
 			}
-			listDecoded.insert(listDecoded.end(), temp.begin(), temp.end());
+			});
+		LDPC_PROFILE(workspace.statistics.chaseUnsatisfiedCount += state.satisfiedRank == INT32_MAX);
+		LDPC_PROFILE(DecoderStatistics::increment(workspace.statistics.chaseWinnerHistogram, state.winner));
+	}
+
+	//    OSD  order (. OrderedStatisticsDecoder)
+	/*
+	1.   BP;    ,  BP .
+	2.   LLR     ,    
+	            order  .
+	     .  0 -   ,
+	    (N - M)^order:       1-2.
+	*/
+	vector<int> osdDecode(const vector<double>& channelOutputs, int order) {
+		vector<int> decoded(informationBitIndexes.size());
+		osdDecode(channelOutputs.data(), order, decoded.data());
+		return decoded;
+	}
+
+	//    OSD   
+	//       BP   .
+	void osdDecode(const double* channelOutputs, int order, int* decoded) {
+		if (order < 0) {
+			throw invalid_argument("OSD order must be non-negative");
+		}
+		executeMessagePassing(workspace, channelOutputs);
+		estimateInformationBits(workspace, decoded);
+		LDPC_PROFILE(workspace.statistics.osdDecodeCount++);
+		if (isSatisfyAllChecks(workspace)) return;
+
+		LDPC_PROFILE(uint64_t start = DecoderStatistics::now());
+		OrderedStatisticsDecoder& osd = workspace.osd;
+		osd.llrs.resize(codeLength);
+		for (int v = 0; v < codeLength; v++) {
+			osd.llrs[v] = marginalize(workspace, v);
+		}
+		osd.decode(tannerGraph(), frozenBitIndexes, order);
+		for (size_t i = 0; i < informationBitIndexes.size(); i++) {
+			decoded[i] = osd.codeword[informationBitIndexes[i]];
+		}
+		LDPC_PROFILE(workspace.statistics.osdPostprocessCount++);
+		LDPC_PROFILE(workspace.statistics.osdPatternCount += osd.patternCount);
+		LDPC_PROFILE(workspace.statistics.osdNanoseconds += DecoderStatistics::lap(start));
+	}
+
+	//  :        
+	/*
+	frames - frameCount  ,  codeLength  LLR  .
+	    ,      ;     .
+	*/
+	vector<vector<int>> decodeBatch(const double* frames, int frameCount) {
+		size_t K = informationBitIndexes.size();
+		vector<int> flat(frameCount * K);
+		decodeBatch(frames, frameCount, flat.data());
+		vector<vector<int>> decoded(frameCount);
+		for (int frame = 0; frame < frameCount; frame++) {
+			decoded[frame].assign(flat.begin() + frame * K, flat.begin() + (frame + 1) * K);
+		}
+		return decoded;
+	}
+
+	//     : decoded - frameCount   K  
+	void decodeBatch(const double* frames, int frameCount, int* decoded) {
+		prepareWorkerWorkspaces();
+		//        function   
+		struct BatchBuffers {
+			const double* frames;
+			int* decoded;
+		} buffers{ frames, decoded };
+		threadPool.pool->parallelFor(frameCount, [this, &buffers](int worker, int frame) {
+			DecodingWorkspace& ws = workerWorkspaces[worker];
+			executeMessagePassing(ws, buffers.frames + static_cast<size_t>(frame) * codeLength);
+			estimateInformationBits(ws, buffers.decoded + static_cast<size_t>(frame) * informationBitIndexes.size());
+			});
+	}
+
+	//   BP   decode/listDecode ( )
+	int getIterationCount() const {
+		return workspace.iterationCount;
+	}
+
+	//   BP   decode/listDecode
+	TerminationReason getTerminationReason() const {
+		return workspace.terminationReason;
+	}
+
+#ifdef LDPC_INSTRUMENTATION
+	//     (   ),   
+	//   :     .
+	DecoderStatistics getStatistics() const {
+		DecoderStatistics total = workspace.statistics;
+		for (const auto& ws : workerWorkspaces) {
+			total.merge(ws.statistics);
+		}
+		return total;
+	}
+
+	void resetStatistics() {
+		workspace.statistics = DecoderStatistics();
+		for (auto& ws : workerWorkspaces) {
+			ws.statistics = DecoderStatistics();
+		}
+	}
+
+#endif
+	//        LLR (  mt19937::default_seed)
+	//       ;        .
+	void setSeed(uint32_t generatorSeed) {
+		seed = generatorSeed;
+		workspace.generator.seed(seed);
+		for (size_t w = 0; w < workerWorkspaces.size(); w++) {
+			seedWorker(workerWorkspaces[w], static_cast<int>(w) + 1);
+		}
+	}
+
+	//       (  );     
+	void setThreadCount(int threadCount) {
+		if (threadCount < 1) {
+			throw invalid_argument("Thread count must be positive");
+		}
+		threadPool.threadCount = threadCount;
+		threadPool.pool.reset();
+	}
+
+	//      (   SPA)
+	void setCheckNodeRule(CheckNodeRule rule) {
+		checkNodeRule = rule;
+	}
+
+	//     (  )
+	void setSchedule(DecodingSchedule decodingSchedule) {
+		schedule = decodingSchedule;
+	}
+
+	//        (  40 ,  )
+	void setStoppingCriteria(const StoppingCriteria& criteria) {
+		if (criteria.iterationLimit < 1 || criteria.stagnationIterations < 0 ||
+			criteria.plateauIterations < 0 || criteria.oscillationIterations < 0) {
+			throw invalid_argument("Invalid stopping criteria");
+		}
+		stoppingCriteria = criteria;
+	}
+
+	const StoppingCriteria& getStoppingCriteria() const {
+		return stoppingCriteria;
+	}
+
+	//   residual BP    (0 - iterationLimit * edgeCount,  ,   )
+	void setResidualBudget(long long edgeUpdates) {
+		if (edgeUpdates < 0) {
+			throw invalid_argument("Residual budget must not be negative");
 		}
+		residualBudget = edgeUpdates;
+	}
 
-		return listDecoded;
+	//   min-sum: alpha    beta   
+	void setMinSumParameters(double alpha, double beta) {
+		if (alpha <= 0 || beta < 0) {
+			throw invalid_argument("Invalid min-sum parameters");
+		}
+		normalizationFactor = alpha;
+		offsetFactor = beta;
 	}
 
 	//    
@@ -255,6 +3576,16 @@ public:
 		return static_cast<double>(informationBitIndexes.size() - ambiguousBitCount) / getRealCodeLength();
 	}
 
+	//      (  )
+	int getCodeLength() const {
+		return codeLength;
+	}
+
+	//    
+	const vector<int>& getFrozenBitIndexes() const {
+		return frozenBitIndexes;
+	}
+
 	//     
 	int getRealCodeLength() const {
 		return codeLength - frozenBitIndexes.size();
@@ -265,39 +3596,175 @@ public:
 		int originalCodeLength,
 		int informationBitSize,
 		int variableNodeDegree,
-		int checkNodeDegree) {
+		int checkNodeDegree,
+		InformationPositions positions = InformationPositions::EncoderFreeColumns) {
+
+		return constructRegularCode(originalCodeLength, informationBitSize, variableNodeDegree, checkNodeDegree,
+			createRandomEdges(originalCodeLength, variableNodeDegree, checkNodeDegree), positions);
+	}
+
+	//   LDPC-   PEG:        (   )
+	//           .
+	static LDPCCode constructProgressiveEdgeGrowthCode(
+		int originalCodeLength,
+		int informationBitSize,
+		int variableNodeDegree,
+		int checkNodeDegree,
+		uint64_t seed,
+		InformationPositions positions = InformationPositions::EncoderFreeColumns) {
+
+		return constructRegularCode(originalCodeLength, informationBitSize, variableNodeDegree, checkNodeDegree,
+			ProgressiveEdgeGrowth::build(originalCodeLength, variableNodeDegree, checkNodeDegree, seed), positions);
+	}
+
+	//   LDPC-      Z
+	//   -  informationBitSize ,     .
+	static LDPCCode constructQuasiCyclicCode(const QuasiCyclicBaseGraph& baseGraph, int liftingSize, int informationBitSize) {
+		if (informationBitSize < 0 || informationBitSize > baseGraph.informationColumns * liftingSize) {
+			throw invalid_argument("Invalid information bit size");
+		}
 
 		LDPCCode code;
-		code.codeLength = originalCodeLength;
+		code.quasiCyclic = QuasiCyclicLayout::lift(baseGraph, liftingSize);
+		code.codeLength = baseGraph.columns * liftingSize;
+		code.initializeBitIndexes(informationBitSize, baseGraph.informationColumns * liftingSize, InformationPositions::Prefix);
+		code.pruneFrozenBits();
+		code.initializeWorkspace();
+		return code;
+	}
 
-		//      
-		for (int i = 0; i < informationBitSize; i++) {
-			code.informationBitIndexes.push_back(i);
+	//        alist  Matrix Market (  CSR, . TannerGraph::load)
+	//   -  informationBitSize ,  -  N - M,   constructCode.
+	static LDPCCode loadCode(const string& path, int informationBitSize, InformationPositions positions = InformationPositions::EncoderFreeColumns) {
+		LDPCCode code;
+		code.setGraph(TannerGraph::load(path));
+		code.codeLength = code.tannerGraph().variableCount;
+
+		int originalInfoBitSize = code.tannerGraph().variableCount - code.tannerGraph().checkCount;
+		if (informationBitSize < 0 || informationBitSize > originalInfoBitSize) {
+			throw invalid_argument("Invalid information bit size");
 		}
+		code.initializeBitIndexes(informationBitSize, originalInfoBitSize, positions);
+		code.pruneFrozenBits();
+		code.initializeWorkspace();
+		return code;
+	}
+
+private:
+	//      :   -  informationBitSize,  -  N - M
+	static LDPCCode constructRegularCode(
+		int originalCodeLength,
+		int informationBitSize,
+		int variableNodeDegree,
+		int checkNodeDegree,
+		const vector<Edge>& edges,
+		InformationPositions positions) {
+
+		LDPCCode code;
+		code.codeLength = originalCodeLength;
 
 		int originalInfoBitSize = originalCodeLength -
 			(originalCodeLength * variableNodeDegree) / checkNodeDegree;
+		if (informationBitSize < 0 || informationBitSize > originalInfoBitSize) {
+			throw invalid_argument("Invalid information bit size");
+		}
+
+		//     CSR
+		code.setGraph(TannerGraph::build(originalCodeLength, (originalCodeLength * variableNodeDegree) / checkNodeDegree, edges));
+
+		//      
+		code.initializeBitIndexes(informationBitSize, originalInfoBitSize, positions);
+		code.pruneFrozenBits();
+		code.initializeWorkspace();
+		return code;
+	}
 
-		for (int i = informationBitSize; i < originalInfoBitSize; i++) {
-			code.frozenBitIndexes.push_back(i);
+	//  : Prefix -  [0, informationBitSize),  -  originalInfoBitSize;
+	// EncoderFreeColumns -  informationBitSize       originalInfoBitSize.
+	//   ,   :  Prefix,     H
+	// (    PEG-),    ,     encode.  
+	//   ( N - originalInfoBitSize ) ,        .
+	void initializeBitIndexes(int informationBitSize, int originalInfoBitSize, InformationPositions positions) {
+		systematicColumns = originalInfoBitSize;
+		informationBitIndexes.clear();
+		frozenBitIndexes.clear();
+		const SystematicEncoder& systematicEncoder = getEncoder();
+		if (positions == InformationPositions::Prefix) {
+			for (int i = 0; i < originalInfoBitSize; i++) {
+				(i < informationBitSize ? informationBitIndexes : frozenBitIndexes).push_back(i);
+			}
+			if (!isEncoderSystematic(systematicEncoder)) {
+				throw invalid_argument("Prefix positions are not an information set of the parity-check matrix, use InformationPositions::EncoderFreeColumns");
+			}
+			return;
 		}
 
-		//  
-		code.edges = createRandomEdges(originalCodeLength, variableNodeDegree, checkNodeDegree);
+		const vector<int>& freeColumns = systematicEncoder.freeColumns;
+		informationBitIndexes.assign(freeColumns.begin(), freeColumns.begin() + informationBitSize);
+		frozenBitIndexes.assign(freeColumns.begin() + informationBitSize, freeColumns.begin() + originalInfoBitSize);
+	}
+
+	//      -    (   )
+	bool isEncoderSystematic(const SystematicEncoder& systematicEncoder) const {
+		vector<char> isFree(codeLength, 0);
+		for (int column : systematicEncoder.freeColumns) {
+			isFree[column] = 1;
+		}
+		for (int index : informationBitIndexes) {
+			if (!isFree[index]) return false;
+		}
+		for (int index : frozenBitIndexes) {
+			if (!isFree[index]) return false;
+		}
+		return true;
+	}
 
-		//  
-		code.variableNodes.resize(originalCodeLength);
-		code.checkNodes.resize((originalCodeLength * variableNodeDegree) / checkNodeDegree);
+	//       (     )
+	/*
+	   ()     ,      :
+	    `+Inf`,   .      
+	 ; ,     ,   `Inf`,   .   
+	 ( 0,  LLR `+Inf`).
+	           :
+	   Z     ,   
+	       (   LLR `+Inf`).  
+	(  - [K, informationColumns * Z))     . CSR-  
+	  OSD        (tannerGraph).
+	*/
+	void pruneFrozenBits() {
+		if (frozenBitIndexes.empty()) return;
+		vector<char> isFrozen = frozenMask();
+		if (quasiCyclic.liftingSize == 0) {
+			setGraph(tannerGraph().withoutVariables(isFrozen));
+			return;
+		}
 
-		//   
-		for (int index : code.frozenBitIndexes) {
-			code.variableNodes[index].setIsFrozen(true);
+		sharedGraph = make_shared<SharedGraph>(); // CSR- ( ) -    
+		int Z = quasiCyclic.liftingSize;
+		vector<char> isColumnFrozen(codeLength / Z, 1);
+		for (int v = 0; v < codeLength; v++) {
+			if (!isFrozen[v]) isColumnFrozen[v / Z] = 0;
 		}
+		if (find(isColumnFrozen.begin(), isColumnFrozen.end(), 1) == isColumnFrozen.end()) return;
+		quasiCyclic = quasiCyclic.withoutColumns(isColumnFrozen);
+	}
 
-		return code;
+	//       ,   
+	void initializeWorkspace() {
+		workspace.variableNodes.resize(codeLength);
+		workspace.checkToVariable.assign(edgeCount(), 0.0);
+		workspace.variableToCheck.assign(edgeCount(), 0.0);
+		workspace.aPosterioriLLRs.assign(codeLength, 0.0);
+		workspace.layerMessages.assign(quasiCyclic.liftingSize > 0 ? 2 * quasiCyclic.maxRowDegree() * quasiCyclic.liftingSize : tannerGraph().maxCheckDegree(), 0.0);
+		workspace.blockMinimums.assign(4 * quasiCyclic.liftingSize, 0.0);
+		workspace.floodingLLRs.assign(quasiCyclic.liftingSize > 0 ? codeLength : 0, 0.0);
+		workspace.ambiguousBits.reserve(informationBitIndexes.size());
+
+		for (int index : frozenBitIndexes) {
+			workspace.variableNodes[index].setIsFrozen(true);
+		}
 	}
 
-private:
 	//      
 	//    ,   ( ).
 	static vector<Edge> createRandomEdges(int length, int variableNodeDegree, int checkNodeDegree) {
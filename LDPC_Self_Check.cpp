@@ -0,0 +1,156 @@
+//  :      SNR   ,   
+/*
+ (    ):
+	g++ -std=c++17 -O2 -pthread LDPC_Self_Check.cpp -o ldpc_self_check
+
+  ;   0 -   , 1 -   ( FAIL  ).
+
+1. :  (256, 3, 6), PEG (256, 3, 6)   5G NR BG2  Z = 16.   
+      (  )   (     ,
+      -      ).
+2.       :     encode,
+         ( PEG    
+       ,    - )     (    ),
+    BPSK  AWGN  sigma = 0.5: decode      , decodeBatch -  .
+3.          :  PEG-
+            ,       `+Inf`   
+    (     ,   ).
+*/
+#include "LDPC_List_Decoder.cpp"
+
+#include <cstdio>
+
+static const CheckNodeRule rules[] = { CheckNodeRule::SumProduct, CheckNodeRule::MinSum, CheckNodeRule::NormalizedMinSum, CheckNodeRule::OffsetMinSum };
+static const char* ruleNames[] = { "spa", "ms", "nms", "oms" };
+static const DecodingSchedule schedules[] = { DecodingSchedule::Flooding, DecodingSchedule::Layered, DecodingSchedule::Residual };
+static const char* scheduleNames[] = { "flooding", "layered", "residual" };
+
+const int frameCount = 20; //    ,   
+const double sigma = 0.5; //   AWGN (BPSK,  SNR)
+
+int failureCount = 0;
+
+//   :  FAIL     
+static void check(bool condition, const string& what) {
+	if (!condition) {
+		printf("FAIL %s\n", what.c_str());
+		failureCount++;
+	}
+}
+
+//   :   K    (  )     
+struct CheckedCode {
+	string name;
+	LDPCCode code;
+	int informationBitSize;
+	shared_ptr<LDPCCode> fullCode; //        (nullptr -   )
+	vector<Edge> edges; //      H * c = 0 ( -   )
+	int checkCount;
+};
+
+//        edges   
+static bool satisfiesChecks(const vector<Edge>& edges, int checkCount, const vector<int>& codeword) {
+	vector<int> parity(checkCount, 0);
+	for (const Edge& edge : edges) {
+		parity[edge.checkNodeIndex] ^= codeword[edge.variableNodeIndex] & 1;
+	}
+	return find(parity.begin(), parity.end(), 1) == parity.end();
+}
+
+//  LLR  : BPSK (0 -> +1)  AWGN   noise (0 -  )
+static void transmit(const vector<int>& codeword, double noise, mt19937& generator, double* channel) {
+	normal_distribution<double> distribution(0.0, 1.0);
+	for (size_t i = 0; i < codeword.size(); i++) {
+		double y = (codeword[i] ? -1.0 : 1.0) + noise * distribution(generator);
+		channel[i] = 2.0 * y / (sigma * sigma);
+	}
+}
+
+//        
+static void checkCode(CheckedCode& checked) {
+	LDPCCode& code = checked.code;
+	const int N = code.getCodeLength();
+	const int K = checked.informationBitSize;
+	code.setThreadCount(2);
+
+	for (int r = 0; r < 4; r++) {
+		for (int s = 0; s < 3; s++) {
+			string what = checked.name + " " + ruleNames[r] + " " + scheduleNames[s];
+			code.setCheckNodeRule(rules[r]);
+			code.setSchedule(schedules[s]);
+			if (checked.fullCode) {
+				checked.fullCode->setCheckNodeRule(rules[r]);
+				checked.fullCode->setSchedule(schedules[s]);
+			}
+			mt19937 generator(1 + r * 3 + s);
+			vector<int> informationBits(K), codeword(N);
+			vector<vector<int>> expected;
+			vector<double> frames(static_cast<size_t>(frameCount) * N), channel(N);
+			int failedFrames = 0, mismatchedFrames = 0;
+
+			for (int f = 0; f < frameCount; f++) {
+				for (int& bit : informationBits) bit = generator() & 1;
+				code.encode(informationBits.data(), codeword.data());
+
+				//  :  ,       
+				bool isCodeword = satisfiesChecks(checked.edges, checked.checkCount, codeword);
+				transmit(codeword, 0.0, generator, channel.data());
+				isCodeword = isCodeword && code.decode(channel) == informationBits && code.getTerminationReason() == TerminationReason::Converged;
+
+				double* frame = frames.data() + static_cast<size_t>(f) * N;
+				transmit(codeword, sigma, generator, frame);
+				vector<int> decoded = code.decode(vector<double>(frame, frame + N));
+				bool isDecoded = decoded == informationBits && code.getTerminationReason() == TerminationReason::Converged;
+				failedFrames += !isCodeword || !isDecoded;
+				expected.push_back(informationBits);
+
+				//     :     +Inf
+				if (checked.fullCode) {
+					vector<double> fullChannel(frame, frame + N);
+					for (int index : code.getFrozenBitIndexes()) {
+						fullChannel[index] = INFINITY;
+					}
+					vector<int> fullDecoded = checked.fullCode->decode(fullChannel);
+					fullDecoded.resize(K);
+					bool isSame = fullDecoded == decoded;
+					if (schedules[s] != DecodingSchedule::Residual) {
+						isSame = isSame && checked.fullCode->getIterationCount() == code.getIterationCount();
+					}
+					mismatchedFrames += !isSame;
+				}
+			}
+			check(failedFrames == 0, what + ": encode -> decode failed on " + to_string(failedFrames) + " of " + to_string(frameCount) + " frames");
+			check(code.decodeBatch(frames.data(), frameCount) == expected, what + ": decodeBatch differs from the information words");
+			check(mismatchedFrames == 0, what + ": pruned and full graphs differ on " + to_string(mismatchedFrames) + " frames");
+			printf("%s %s\n", failedFrames == 0 && mismatchedFrames == 0 ? "ok  " : "FAIL", what.c_str());
+		}
+	}
+}
+
+int main() {
+	const QuasiCyclicBaseGraph baseGraph = QuasiCyclicBaseGraph::nrBaseGraph(2);
+	const int Z = 16;
+	const int quasiCyclicK = baseGraph.informationColumns * Z;
+	const uint64_t seed = 7;
+
+	vector<CheckedCode> codes;
+	for (int K : { 128, 100 }) {
+		string suffix = K == 128 ? " full" : " shortened";
+		codes.push_back({ "random" + suffix, LDPCCode::constructCode(256, K, 3, 6), K, nullptr, {}, 128 });
+		codes.push_back({ "peg" + suffix, LDPCCode::constructProgressiveEdgeGrowthCode(256, K, 3, 6, seed), K,
+			K == 128 ? nullptr : make_shared<LDPCCode>(LDPCCode::constructProgressiveEdgeGrowthCode(256, 128, 3, 6, seed)),
+			ProgressiveEdgeGrowth::build(256, 3, 6, seed), 128 });
+	}
+	for (int K : { quasiCyclicK, quasiCyclicK - Z - 5 }) {
+		string suffix = K == quasiCyclicK ? " full" : " shortened";
+		codes.push_back({ "qc-bg2-z16" + suffix, LDPCCode::constructQuasiCyclicCode(baseGraph, Z, K), K,
+			K == quasiCyclicK ? nullptr : make_shared<LDPCCode>(LDPCCode::constructQuasiCyclicCode(baseGraph, Z, quasiCyclicK)),
+			QuasiCyclicLayout::lift(baseGraph, Z).expandEdges(), baseGraph.rows * Z });
+	}
+
+	for (CheckedCode& checked : codes) {
+		checkCode(checked);
+	}
+	printf("%s: %d failed checks\n", failureCount == 0 ? "PASSED" : "FAILED", failureCount);
+	return failureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,448 @@
+// -  BER/FER  LDPC- (BPSK,  AWGN)
+/*
+ (    ):
+	g++ -std=c++17 -O3 -march=native -pthread LDPC_Simulator.cpp -o ldpc_simulator
+  AFF3CT ( --decoder aff3ct):
+	g++ -std=c++17 -O3 -march=native -pthread -DLDPC_SIMULATOR_AFF3CT -I<aff3ct>/include -I<aff3ct>/src \
+		LDPC_Simulator.cpp Aff3ct_List_Decoder_Module/Decoder_LDPC.cpp Aff3ct_List_Decoder_Module/Thread_Pool.cpp -laff3ct
+  (--stats .json):   -DLDPC_INSTRUMENTATION.
+
+:
+	ldpc_simulator --n 1008 --k 500 --peg 1 --rule nms --schedule layered --ebn0 1:3:0.5 --fe 100
+	ldpc_simulator --n 128 --k 64 --peg 1 --rule nms --decoder osd --osd-order 2 --ebn0 1:4:0.5 --fe 100
+
+1.     ( ,  ),  -   :
+        (, ,  ),       .
+    --codewords random           (LDPCCode::encode,
+    AFF3CT - Decoder_LDPC::encode) -     ;    
+     .
+     -    (InformationPositions::EncoderFreeColumns,  ).
+2.    ;  ,   --fe   ( --max-frames).
+        ,  --fe , -     .
+3.   -        ,
+    -     .
+*/
+#include "LDPC_List_Decoder.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+
+#ifdef LDPC_SIMULATOR_AFF3CT
+#include "Aff3ct_List_Decoder_Module/Decoder_LDPC.hpp"
+#endif
+
+//  :  -      (SplitMix64),   
+struct CounterRandom {
+	uint64_t key; //    (, , )
+	uint64_t counter = 0; //   
+
+	static uint64_t mix(uint64_t x) {
+		x += 0x9e3779b97f4a7c15ULL;
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+		return x ^ (x >> 31);
+	}
+
+	CounterRandom(uint64_t seed, uint64_t point, uint64_t frame)
+		: key(mix(mix(seed) ^ mix(point * 0x100000001b3ULL + frame))) {
+	}
+
+	// 64  
+	uint64_t bits() {
+		return mix(key ^ counter++);
+	}
+
+	//   (0, 1)
+	double uniform() {
+		return (static_cast<double>(mix(key ^ counter++) >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+	}
+
+	//    ( - )
+	pair<double, double> gaussianPair() {
+		double radius = sqrt(-2.0 * log(uniform()));
+		double angle = 2.0 * acos(-1.0) * uniform();
+		return { radius * cos(angle), radius * sin(angle) };
+	}
+};
+
+//   (  )
+struct SimulationOptions {
+	string decoder = "bp"; // bp (LDPCCode::decode), list (listDecode), osd (osdDecode), aff3ct ( AFF3CT)
+	int listSize = 8; //    list
+	int osdOrder = 2; //  OSD  osd
+	string alistPath; //    (alist  Matrix Market);   
+	int codeLength = 1008; // N  
+	int informationBitSize = 504; // K
+	int variableNodeDegree = 3; // dv
+	int checkNodeDegree = 6; // dc
+	long long pegSeed = -1; //  PEG (-1 -  )
+	CheckNodeRule rule = CheckNodeRule::SumProduct;
+	DecodingSchedule schedule = DecodingSchedule::Flooding; // flooding, layered, residual
+	long long residualBudget = 0; //  residual BP    (0 -    )
+	StoppingCriteria stopping; // --max-iterations, --stagnation, --plateau, --oscillation (0 -  )
+	double ebn0Start = 1.0, ebn0Stop = 3.0, ebn0Step = 0.5; //  Eb/N0 ()
+	long long targetFrameErrors = 100; //    
+	long long maxFrames = 10000000; //    
+	int threadCount = max(1, static_cast<int>(thread::hardware_concurrency()));
+	uint64_t seed = 1; //  
+	int chunkSize = 32; //   ,  
+	string statisticsPath; //  JSON      (LDPC_INSTRUMENTATION)
+	bool randomCodewords = false; // --codewords random:      ( zero)
+
+	static SimulationOptions parse(int argc, char** argv) {
+		SimulationOptions options;
+		for (int i = 1; i < argc; i++) {
+			string name = argv[i];
+			if (i + 1 >= argc) {
+				throw invalid_argument("Missing value for " + name);
+			}
+			string value = argv[++i];
+			if (name == "--decoder") options.decoder = value;
+			else if (name == "--list-size") options.listSize = stoi(value);
+			else if (name == "--osd-order") options.osdOrder = stoi(value);
+			else if (name == "--alist") options.alistPath = value;
+			else if (name == "--n") options.codeLength = stoi(value);
+			else if (name == "--k") options.informationBitSize = stoi(value);
+			else if (name == "--dv") options.variableNodeDegree = stoi(value);
+			else if (name == "--dc") options.checkNodeDegree = stoi(value);
+			else if (name == "--peg") options.pegSeed = stoll(value);
+			else if (name == "--rule") options.rule = parseRule(value);
+			else if (name == "--schedule") options.schedule = parseSchedule(value);
+			else if (name == "--residual-budget") options.residualBudget = stoll(value);
+			else if (name == "--max-iterations") options.stopping.iterationLimit = stoi(value);
+			else if (name == "--stagnation") options.stopping.stagnationIterations = stoi(value);
+			else if (name == "--plateau") options.stopping.plateauIterations = stoi(value);
+			else if (name == "--oscillation") options.stopping.oscillationIterations = stoi(value);
+			else if (name == "--ebn0") parseRange(value, options);
+			else if (name == "--fe") options.targetFrameErrors = stoll(value);
+			else if (name == "--max-frames") options.maxFrames = stoll(value);
+			else if (name == "--threads") options.threadCount = stoi(value);
+			else if (name == "--seed") options.seed = stoull(value);
+			else if (name == "--stats") options.statisticsPath = value;
+			else if (name == "--codewords") options.randomCodewords = parseCodewords(value);
+			else throw invalid_argument("Unknown option " + name);
+		}
+		if (options.threadCount < 1 || options.osdOrder < 0 || options.targetFrameErrors < 1 || options.maxFrames < 1 || options.ebn0Step <= 0) {
+			throw invalid_argument("Invalid simulation options");
+		}
+		return options;
+	}
+
+	static CheckNodeRule parseRule(const string& value) {
+		if (value == "spa") return CheckNodeRule::SumProduct;
+		if (value == "ms") return CheckNodeRule::MinSum;
+		if (value == "nms") return CheckNodeRule::NormalizedMinSum;
+		if (value == "oms") return CheckNodeRule::OffsetMinSum;
+		throw invalid_argument("Unknown check node rule " + value);
+	}
+
+	static bool parseCodewords(const string& value) {
+		if (value == "zero") return false;
+		if (value == "random") return true;
+		throw invalid_argument("Unknown codewords " + value);
+	}
+
+	static DecodingSchedule parseSchedule(const string& value) {
+		if (value == "flooding") return DecodingSchedule::Flooding;
+		if (value == "layered") return DecodingSchedule::Layered;
+		if (value == "residual") return DecodingSchedule::Residual;
+		throw invalid_argument("Unknown schedule " + value);
+	}
+
+	//  `start:stop:step`   
+	static void parseRange(const string& value, SimulationOptions& options) {
+		size_t first = value.find(':');
+		if (first == string::npos) {
+			options.ebn0Start = options.ebn0Stop = stod(value);
+			return;
+		}
+		size_t second = value.find(':', first + 1);
+		options.ebn0Start = stod(value.substr(0, first));
+		options.ebn0Stop = stod(value.substr(first + 1, second - first - 1));
+		if (second != string::npos) options.ebn0Step = stod(value.substr(second + 1));
+	}
+};
+
+//   :  LLR ->     ,   (-1,  )
+using FrameDecoder = function<void(const vector<double>&, vector<int>&, int&)>;
+
+//     --codewords random:   ->  
+using FrameEncoder = function<void(const vector<int>&, vector<int>&)>;
+
+//   
+struct ChunkResult {
+	long long frames = 0;
+	long long frameErrors = 0;
+	long long bitErrors = 0;
+	long long iterations = 0;
+	long long iterationFrames = 0; //     
+};
+
+//   Eb/N0
+struct PointResult {
+	ChunkResult counted; //   
+	long long decodedFrames = 0; //    (  )
+	double seconds = 0;
+	vector<double> latencies; //    ()
+#ifdef LDPC_INSTRUMENTATION
+	DecoderStatistics statistics; //   ,    
+#endif
+};
+
+class Simulator {
+private:
+	SimulationOptions options;
+	LDPCCode code; //  ,   -    
+	int codeLength = 0;
+	int informationBitSize = 0;
+	double rate = 0;
+#ifdef LDPC_SIMULATOR_AFF3CT
+	unique_ptr<aff3ct::module::Decoder_LDPC<int, float>> aff3ctDecoder;
+#endif
+
+	//     ; local -    (  AFF3CT:   ,
+	//       )
+	FrameDecoder createDecoder(shared_ptr<LDPCCode>& local, FrameEncoder& encoder) {
+#ifdef LDPC_SIMULATOR_AFF3CT
+		if (options.decoder == "aff3ct") {
+			shared_ptr<aff3ct::module::Decoder_LDPC<int, float>> decoder(aff3ctDecoder->clone());
+			auto input = make_shared<vector<float>>(codeLength);
+			encoder = [decoder](const vector<int>& information, vector<int>& codeword) {
+				decoder->encode(information.data(), codeword.data());
+			};
+			return [decoder, input](const vector<double>& llrs, vector<int>& decoded, int& iterations) {
+				copy(llrs.begin(), llrs.end(), input->begin());
+				decoder->decode_siho(input->data(), decoded.data());
+				iterations = decoder->getIterationCount();
+			};
+		}
+#endif
+		local = make_shared<LDPCCode>(code);
+		encoder = [local](const vector<int>& information, vector<int>& codeword) {
+			local->encode(information.data(), codeword.data());
+		};
+		if (options.decoder == "list") {
+			int listSize = options.listSize;
+			return [local, listSize](const vector<double>& llrs, vector<int>& decoded, int& iterations) {
+				local->listDecode(llrs.data(), listSize, decoded.data());
+				iterations = local->getIterationCount();
+			};
+		}
+		if (options.decoder == "osd") {
+			int order = options.osdOrder;
+			return [local, order](const vector<double>& llrs, vector<int>& decoded, int& iterations) {
+				local->osdDecode(llrs.data(), order, decoded.data());
+				iterations = local->getIterationCount();
+			};
+		}
+		return [local](const vector<double>& llrs, vector<int>& decoded, int& iterations) {
+			local->decode(llrs.data(), decoded.data());
+			iterations = local->getIterationCount();
+		};
+	}
+
+	PointResult simulatePoint(int point, double ebn0) {
+		double sigma = sqrt(1.0 / (2.0 * rate * pow(10.0, ebn0 / 10.0)));
+		long long maxChunks = (options.maxFrames + options.chunkSize - 1) / options.chunkSize;
+
+		atomic<long long> nextChunk{ 0 };
+		atomic<long long> frameErrors{ 0 };
+		mutex resultMutex;
+		map<long long, ChunkResult> chunks;
+		PointResult result;
+
+		auto worker = [&]() {
+			shared_ptr<LDPCCode> local;
+			FrameEncoder encoder;
+			FrameDecoder decoder = createDecoder(local, encoder);
+			vector<double> llrs(codeLength);
+			vector<int> decoded(informationBitSize), information(informationBitSize, 0), codeword(codeLength, 0);
+			vector<double> latencies;
+			long long decodedFrames = 0;
+			while (frameErrors.load(memory_order_relaxed) < options.targetFrameErrors) {
+				long long chunk = nextChunk.fetch_add(1);
+				if (chunk >= maxChunks) break;
+
+				ChunkResult chunkResult;
+				long long first = chunk * options.chunkSize;
+				long long last = min<long long>(first + options.chunkSize, options.maxFrames);
+				for (long long frame = first; frame < last; frame++) {
+					// BPSK 0 -> +1, 1 -> -1, LLR = 2y / sigma^2
+					CounterRandom random(options.seed, point, frame);
+					if (options.randomCodewords) {
+						uint64_t bits = 0;
+						for (int i = 0; i < informationBitSize; i++) {
+							if (i % 64 == 0) bits = random.bits();
+							information[i] = (bits >> (i % 64)) & 1;
+						}
+						encoder(information, codeword);
+					}
+					for (int i = 0; i < codeLength; i += 2) {
+						pair<double, double> noise = random.gaussianPair();
+						llrs[i] = 2.0 * ((codeword[i] ? -1.0 : 1.0) + sigma * noise.first) / (sigma * sigma);
+						if (i + 1 < codeLength) llrs[i + 1] = 2.0 * ((codeword[i + 1] ? -1.0 : 1.0) + sigma * noise.second) / (sigma * sigma);
+					}
+
+					int iterations = -1;
+					auto start = chrono::steady_clock::now();
+					decoder(llrs, decoded, iterations);
+					latencies.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - start).count());
+					decodedFrames++;
+
+					long long errors = 0;
+					for (int i = 0; i < informationBitSize; i++) {
+						errors += decoded[i] != information[i];
+					}
+					chunkResult.frames++;
+					chunkResult.bitErrors += errors;
+					chunkResult.frameErrors += errors > 0;
+					if (iterations >= 0) {
+						chunkResult.iterations += iterations;
+						chunkResult.iterationFrames++;
+					}
+				}
+				frameErrors += chunkResult.frameErrors;
+
+				lock_guard<mutex> lock(resultMutex);
+				chunks[chunk] = chunkResult;
+			}
+			lock_guard<mutex> lock(resultMutex);
+			result.decodedFrames += decodedFrames;
+			result.latencies.insert(result.latencies.end(), latencies.begin(), latencies.end());
+			LDPC_PROFILE(if (local) result.statistics.merge(local->getStatistics()));
+		};
+
+		auto start = chrono::steady_clock::now();
+		vector<thread> threads;
+		for (int t = 1; t < options.threadCount; t++) {
+			threads.emplace_back(worker);
+		}
+		worker();
+		for (auto& t : threads) {
+			t.join();
+		}
+		result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		//      ,  
+		for (const auto& entry : chunks) {
+			ChunkResult& counted = result.counted;
+			counted.frames += entry.second.frames;
+			counted.frameErrors += entry.second.frameErrors;
+			counted.bitErrors += entry.second.bitErrors;
+			counted.iterations += entry.second.iterations;
+			counted.iterationFrames += entry.second.iterationFrames;
+			if (counted.frameErrors >= options.targetFrameErrors) break;
+		}
+		return result;
+	}
+
+	//    ,  PEG    
+	//   -    (  H,    - )
+	static LDPCCode createCode(const SimulationOptions& options) {
+		if (!options.alistPath.empty()) {
+			return LDPCCode::loadCode(options.alistPath, options.informationBitSize);
+		}
+		if (options.pegSeed >= 0) {
+			return LDPCCode::constructProgressiveEdgeGrowthCode(options.codeLength, options.informationBitSize,
+				options.variableNodeDegree, options.checkNodeDegree, static_cast<uint64_t>(options.pegSeed));
+		}
+		return LDPCCode::constructCode(options.codeLength, options.informationBitSize, options.variableNodeDegree, options.checkNodeDegree);
+	}
+
+	static double percentile(vector<double>& values, double fraction) {
+		if (values.empty()) return 0;
+		size_t index = min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+		nth_element(values.begin(), values.begin() + index, values.end());
+		return values[index];
+	}
+
+public:
+	explicit Simulator(const SimulationOptions& simulationOptions) : options(simulationOptions), code(createCode(simulationOptions)) {
+		code.setCheckNodeRule(options.rule);
+		code.setSchedule(options.schedule);
+		code.setResidualBudget(options.residualBudget);
+		code.setStoppingCriteria(options.stopping);
+		codeLength = code.getCodeLength();
+		informationBitSize = options.informationBitSize;
+		rate = code.getRate();
+
+		if (options.decoder == "aff3ct") {
+#ifdef LDPC_SIMULATOR_AFF3CT
+			if (options.alistPath.empty()) {
+				throw invalid_argument("The AFF3CT decoder needs --alist");
+			}
+			if (options.schedule == DecodingSchedule::Residual) {
+				throw invalid_argument("The AFF3CT decoder has no residual schedule");
+			}
+			aff3ctDecoder.reset(new aff3ct::module::Decoder_LDPC<int, float>(informationBitSize, codeLength, code.getFrozenBitIndexes(), options.alistPath));
+			aff3ctDecoder->setCheckNodeRule(static_cast<aff3ct::module::CheckNodeRule>(options.rule));
+			aff3ctDecoder->setSchedule(static_cast<aff3ct::module::DecodingSchedule>(options.schedule));
+			aff3ct::module::StoppingCriteria stopping;
+			stopping.iterationLimit = options.stopping.iterationLimit;
+			stopping.stagnationIterations = options.stopping.stagnationIterations;
+			stopping.plateauIterations = options.stopping.plateauIterations;
+			stopping.oscillationIterations = options.stopping.oscillationIterations;
+			aff3ctDecoder->setStoppingCriteria(stopping);
+#else
+			throw invalid_argument("Rebuild with -DLDPC_SIMULATOR_AFF3CT for the AFF3CT decoder");
+#endif
+		}
+		else if (options.decoder != "bp" && options.decoder != "list" && options.decoder != "osd") {
+			throw invalid_argument("Unknown decoder " + options.decoder);
+		}
+#ifndef LDPC_INSTRUMENTATION
+		if (!options.statisticsPath.empty()) {
+			throw invalid_argument("Rebuild with -DLDPC_INSTRUMENTATION for --stats");
+		}
+#endif
+	}
+
+	void run() {
+		printf("# decoder=%s N=%d K=%d R=%.4f threads=%d fe=%lld seed=%llu\n", options.decoder.c_str(), codeLength, informationBitSize,
+			rate, options.threadCount, options.targetFrameErrors, static_cast<unsigned long long>(options.seed));
+		printf("%8s %10s %10s %12s %12s %8s %10s %10s %10s %10s %10s\n",
+			"Eb/N0", "frames", "fe", "BER", "FER", "iters", "Mbps", "p50_us", "p90_us", "p99_us", "max_us");
+
+		ofstream statistics;
+		if (!options.statisticsPath.empty()) {
+			statistics.open(options.statisticsPath);
+			if (!statistics) {
+				throw runtime_error("Cannot write " + options.statisticsPath);
+			}
+			statistics << "[";
+		}
+
+		int point = 0;
+		for (double ebn0 = options.ebn0Start; ebn0 <= options.ebn0Stop + 1e-9; ebn0 += options.ebn0Step, point++) {
+			PointResult result = simulatePoint(point, ebn0);
+			const ChunkResult& counted = result.counted;
+			double ber = counted.frames ? static_cast<double>(counted.bitErrors) / (static_cast<double>(counted.frames) * informationBitSize) : 0;
+			double fer = counted.frames ? static_cast<double>(counted.frameErrors) / counted.frames : 0;
+			double mbps = result.decodedFrames * static_cast<double>(informationBitSize) / result.seconds / 1e6;
+			char iterations[16] = "-";
+			if (counted.iterationFrames > 0) {
+				snprintf(iterations, sizeof(iterations), "%.2f", static_cast<double>(counted.iterations) / counted.iterationFrames);
+			}
+			double maxLatency = result.latencies.empty() ? 0 : *max_element(result.latencies.begin(), result.latencies.end());
+			printf("%8.2f %10lld %10lld %12.4e %12.4e %8s %10.3f %10.1f %10.1f %10.1f %10.1f\n",
+				ebn0, counted.frames, counted.frameErrors, ber, fer, iterations, mbps,
+				percentile(result.latencies, 0.5), percentile(result.latencies, 0.9), percentile(result.latencies, 0.99), maxLatency);
+			fflush(stdout);
+			LDPC_PROFILE(if (statistics.is_open()) statistics << (point ? ",\n" : "\n") << "{\"ebn0\": " << ebn0 << ", \"statistics\": " << result.statistics.toJson() << "}");
+		}
+		if (statistics.is_open()) statistics << "\n]\n";
+	}
+};
+
+int main(int argc, char** argv) {
+	try {
+		Simulator(SimulationOptions::parse(argc, argv)).run();
+	}
+	catch (const exception& error) {
+		fprintf(stderr, "error: %s\n", error.what());
+		return 1;
+	}
+	return 0;
+}
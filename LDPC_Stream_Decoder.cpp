@@ -0,0 +1,359 @@
+//    LLR:  ->   ->   
+/*
+ (    ):
+	g++ -std=c++17 -O3 -march=native -pthread LDPC_Stream_Decoder.cpp -o ldpc_stream
+
+:
+	ldpc_stream --alist code.alist --k 500 --format f32 --input capture.llr --output decoded.bin --threads 8
+	cat capture.i8 | ldpc_stream --n 1008 --k 504 --peg 1 --format i8 --scale 0.25 --input - --output - > decoded.bin
+
+1.  -   N LLR     : f32 (float)  i8 (int8_t, LLR =  * --scale).
+       (--mmap 0 -  fread), `-` -  .
+2.        (FrameRing):   ,
+    (--threads) ,         .
+       ,   - ,   .
+3.   LLR     double (  )    
+   (LDPCCode::decode / listDecode  vector  ).       .
+4.  - K   ,   8   (  - ), (K + 7) / 8   .
+    (,  BP,  )   stderr.
+*/
+#include "LDPC_List_Decoder.cpp"
+
+#include <climits>
+#include <cstdio>
+
+//    (  )
+struct StreamOptions {
+	string input = "-"; //  LLR  `-` ( )
+	string output = "-"; //    `-` ( )
+	string format = "f32"; // f32  i8
+	double scale = 1.0; //  i8: LLR =  * scale
+	bool memoryMapped = true; //     
+	string decoder = "bp"; // bp (LDPCCode::decode)  list (listDecode)
+	int listSize = 8;
+	string alistPath; //    (alist  Matrix Market)
+	int codeLength = 1008; // N  PEG
+	int informationBitSize = 504; // K
+	int variableNodeDegree = 3;
+	int checkNodeDegree = 6;
+	long long pegSeed = -1; //  PEG ( --alist :    )
+	CheckNodeRule rule = CheckNodeRule::SumProduct;
+	DecodingSchedule schedule = DecodingSchedule::Flooding;
+	int iterationLimit = 40;
+	int threadCount = max(1, static_cast<int>(thread::hardware_concurrency()));
+	int ringSize = 0; //    (0 - 64  )
+	long long maxFrames = -1; //   (-1 -  )
+
+	static StreamOptions parse(int argc, char** argv) {
+		StreamOptions options;
+		for (int i = 1; i < argc; i++) {
+			string name = argv[i];
+			if (i + 1 >= argc) {
+				throw invalid_argument("Missing value for " + name);
+			}
+			string value = argv[++i];
+			if (name == "--input") options.input = value;
+			else if (name == "--output") options.output = value;
+			else if (name == "--format") options.format = value;
+			else if (name == "--scale") options.scale = stod(value);
+			else if (name == "--mmap") options.memoryMapped = stoi(value) != 0;
+			else if (name == "--decoder") options.decoder = value;
+			else if (name == "--list-size") options.listSize = stoi(value);
+			else if (name == "--alist") options.alistPath = value;
+			else if (name == "--n") options.codeLength = stoi(value);
+			else if (name == "--k") options.informationBitSize = stoi(value);
+			else if (name == "--dv") options.variableNodeDegree = stoi(value);
+			else if (name == "--dc") options.checkNodeDegree = stoi(value);
+			else if (name == "--peg") options.pegSeed = stoll(value);
+			else if (name == "--rule") options.rule = parseRule(value);
+			else if (name == "--schedule") options.schedule = parseSchedule(value);
+			else if (name == "--max-iterations") options.iterationLimit = stoi(value);
+			else if (name == "--threads") options.threadCount = stoi(value);
+			else if (name == "--ring") options.ringSize = stoi(value);
+			else if (name == "--frames") options.maxFrames = stoll(value);
+			else throw invalid_argument("Unknown option " + name);
+		}
+		if (options.format != "f32" && options.format != "i8") {
+			throw invalid_argument("Unknown LLR format " + options.format);
+		}
+		if (options.decoder != "bp" && options.decoder != "list") {
+			throw invalid_argument("Unknown decoder " + options.decoder);
+		}
+		if (options.alistPath.empty() && options.pegSeed < 0) {
+			throw invalid_argument("The code needs --alist or --peg");
+		}
+		if (options.threadCount < 1 || options.ringSize < 0 || options.listSize < 1) {
+			throw invalid_argument("Invalid stream options");
+		}
+		if (options.ringSize == 0) options.ringSize = 64 * options.threadCount;
+		return options;
+	}
+
+	static CheckNodeRule parseRule(const string& value) {
+		if (value == "spa") return CheckNodeRule::SumProduct;
+		if (value == "ms") return CheckNodeRule::MinSum;
+		if (value == "nms") return CheckNodeRule::NormalizedMinSum;
+		if (value == "oms") return CheckNodeRule::OffsetMinSum;
+		throw invalid_argument("Unknown check node rule " + value);
+	}
+
+	static DecodingSchedule parseSchedule(const string& value) {
+		if (value == "flooding") return DecodingSchedule::Flooding;
+		if (value == "layered") return DecodingSchedule::Layered;
+		if (value == "residual") return DecodingSchedule::Residual;
+		throw invalid_argument("Unknown schedule " + value);
+	}
+};
+
+//       ( )
+/*
+1.  f   f mod size.   -   (   ):
+   3f -    f, 3f + 1 - , 3f + 2 - ;      f + size.
+2.       ,       ,
+      f - size     f.      .
+3.  :    ,      .
+*/
+class FrameRing {
+public:
+	struct alignas(64) Slot {
+		atomic<long long> sequence{ 0 };
+		const char* llrs = nullptr; // LLR :      buffer
+		vector<char> buffer; //   (  )
+		vector<uint8_t> decoded; //  
+	};
+
+	static const long long unknownFrameCount = LLONG_MAX;
+
+	FrameRing(int size, size_t frameBytes, size_t decodedBytes) : slots(size) {
+		for (int i = 0; i < size; i++) {
+			slots[i].sequence.store(3LL * i, memory_order_relaxed);
+			slots[i].decoded.assign(decodedBytes, 0);
+			if (frameBytes) slots[i].buffer.assign(frameBytes, 0);
+		}
+	}
+
+	Slot& slot(long long frame) {
+		return slots[frame % static_cast<long long>(slots.size())];
+	}
+
+	//   phase (0 - , 1 - , 2 - )  ; false -   (  )
+	bool wait(long long frame, int phase) {
+		const long long expected = 3 * frame + phase;
+		atomic<long long>& sequence = slot(frame).sequence;
+		for (int spin = 0; sequence.load(memory_order_acquire) != expected; spin++) {
+			if (cancelled.load(memory_order_relaxed)) return false;
+			if (phase > 0 && frame >= frameCount.load(memory_order_acquire)) return false;
+			if (spin > 64) this_thread::yield();
+		}
+		return true;
+	}
+
+	//      phase (   )
+	void publish(long long frame, int phase) {
+		slot(frame).sequence.store(3 * frame + phase, memory_order_release);
+	}
+
+	//     frame + size
+	void release(long long frame) {
+		slot(frame).sequence.store(3 * (frame + static_cast<long long>(slots.size())), memory_order_release);
+	}
+
+	long long claim() {
+		return nextFrame.fetch_add(1, memory_order_relaxed);
+	}
+
+	atomic<long long> frameCount{ unknownFrameCount }; //    (   )
+	atomic<bool> cancelled{ false }; //    
+
+private:
+	vector<Slot> slots;
+	atomic<long long> nextFrame{ 0 }; //    
+};
+
+class StreamDecoder {
+private:
+	StreamOptions options;
+	LDPCCode code; //  ,   -    
+	int codeLength = 0;
+	int informationBitSize = 0;
+	size_t llrBytes = 0; //   LLR
+	size_t frameBytes = 0;
+	size_t decodedBytes = 0;
+	shared_ptr<const void> mapping; //   
+	size_t mappingSize = 0;
+	FILE* input = nullptr;
+	FILE* output = nullptr;
+	mutex errorMutex;
+	string error; //   
+
+	static LDPCCode createCode(const StreamOptions& options) {
+		if (!options.alistPath.empty()) {
+			return LDPCCode::loadCode(options.alistPath, options.informationBitSize);
+		}
+		return LDPCCode::constructProgressiveEdgeGrowthCode(options.codeLength, options.informationBitSize,
+			options.variableNodeDegree, options.checkNodeDegree, static_cast<uint64_t>(options.pegSeed));
+	}
+
+	void fail(FrameRing& ring, const string& message) {
+		lock_guard<mutex> lock(errorMutex);
+		if (error.empty()) error = message;
+		ring.cancelled.store(true);
+	}
+
+	// :        ,  fread
+	void readFrames(FrameRing& ring) {
+		long long limit = options.maxFrames >= 0 ? options.maxFrames : FrameRing::unknownFrameCount;
+		long long frame = 0;
+		if (mapping) {
+			if (mappingSize % frameBytes != 0) {
+				fail(ring, "Input size is not a multiple of the frame size");
+				return;
+			}
+			limit = min<long long>(limit, mappingSize / frameBytes);
+		}
+		for (; frame < limit; frame++) {
+			if (!ring.wait(frame, 0)) return;
+			FrameRing::Slot& slot = ring.slot(frame);
+			if (mapping) {
+				slot.llrs = static_cast<const char*>(mapping.get()) + static_cast<size_t>(frame) * frameBytes;
+			}
+			else {
+				size_t read = fread(slot.buffer.data(), 1, frameBytes, input);
+				if (read != frameBytes) {
+					if (read != 0) fail(ring, "Truncated frame at the end of the input");
+					else if (ferror(input)) fail(ring, "Cannot read " + options.input);
+					break;
+				}
+				slot.llrs = slot.buffer.data();
+			}
+			ring.publish(frame, 1);
+		}
+		ring.frameCount.store(frame, memory_order_release);
+	}
+
+	// : LLR    double,   ,  
+	void decodeFrames(FrameRing& ring, atomic<long long>& unconverged) {
+		LDPCCode local(code);
+		vector<double> llrs(codeLength);
+		vector<int> decoded(informationBitSize);
+		long long localUnconverged = 0;
+		for (long long frame = ring.claim(); ring.wait(frame, 1); frame = ring.claim()) {
+			FrameRing::Slot& slot = ring.slot(frame);
+			if (options.format == "f32") {
+				const float* values = reinterpret_cast<const float*>(slot.llrs);
+				for (int i = 0; i < codeLength; i++) {
+					float value;
+					memcpy(&value, values + i, sizeof(value));
+					llrs[i] = value;
+				}
+			}
+			else {
+				const int8_t* values = reinterpret_cast<const int8_t*>(slot.llrs);
+				for (int i = 0; i < codeLength; i++) {
+					llrs[i] = values[i] * options.scale;
+				}
+			}
+
+			if (options.decoder == "list") local.listDecode(llrs.data(), options.listSize, decoded.data());
+			else local.decode(llrs.data(), decoded.data());
+			localUnconverged += local.getTerminationReason() != TerminationReason::Converged;
+
+			fill(slot.decoded.begin(), slot.decoded.end(), 0);
+			for (int i = 0; i < informationBitSize; i++) {
+				slot.decoded[i >> 3] |= static_cast<uint8_t>(decoded[i] << (7 - (i & 7)));
+			}
+			ring.publish(frame, 2);
+		}
+		unconverged += localUnconverged;
+	}
+
+	// :    ;     
+	long long writeFrames(FrameRing& ring) {
+		long long frame = 0;
+		for (; ring.wait(frame, 2); frame++) {
+			if (fwrite(ring.slot(frame).decoded.data(), 1, decodedBytes, output) != decodedBytes) {
+				fail(ring, "Cannot write " + options.output);
+				break;
+			}
+			ring.release(frame);
+		}
+		return frame;
+	}
+
+public:
+	explicit StreamDecoder(const StreamOptions& streamOptions) : options(streamOptions), code(createCode(streamOptions)) {
+		code.setCheckNodeRule(options.rule);
+		code.setSchedule(options.schedule);
+		StoppingCriteria stopping;
+		stopping.iterationLimit = options.iterationLimit;
+		code.setStoppingCriteria(stopping);
+		codeLength = code.getCodeLength();
+		informationBitSize = options.informationBitSize;
+		llrBytes = options.format == "f32" ? sizeof(float) : sizeof(int8_t);
+		frameBytes = llrBytes * codeLength;
+		decodedBytes = (informationBitSize + 7) / 8;
+
+		if (options.input == "-") {
+			input = stdin;
+		}
+		else if (options.memoryMapped) {
+			mapping = TannerGraph::mapFile(options.input, mappingSize);
+			if (!mapping) {
+				throw runtime_error("Cannot map " + options.input);
+			}
+#ifndef _WIN32
+			madvise(const_cast<void*>(mapping.get()), mappingSize, MADV_SEQUENTIAL);
+#endif
+		}
+		else if (!(input = fopen(options.input.c_str(), "rb"))) {
+			throw runtime_error("Cannot read " + options.input);
+		}
+
+		output = options.output == "-" ? stdout : fopen(options.output.c_str(), "wb");
+		if (!output) {
+			throw runtime_error("Cannot write " + options.output);
+		}
+	}
+
+	~StreamDecoder() {
+		if (input && input != stdin) fclose(input);
+		if (output && output != stdout) fclose(output);
+	}
+
+	void run() {
+		FrameRing ring(options.ringSize, mapping ? 0 : frameBytes, decodedBytes);
+		atomic<long long> unconverged{ 0 };
+		auto start = chrono::steady_clock::now();
+
+		thread reader([this, &ring] { readFrames(ring); });
+		vector<thread> workers;
+		for (int t = 0; t < options.threadCount; t++) {
+			workers.emplace_back([this, &ring, &unconverged] { decodeFrames(ring, unconverged); });
+		}
+		long long frames = writeFrames(ring);
+		reader.join();
+		for (auto& worker : workers) {
+			worker.join();
+		}
+		if (fflush(output) != 0) fail(ring, "Cannot write " + options.output);
+		if (!error.empty()) {
+			throw runtime_error(error);
+		}
+
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		fprintf(stderr, "# decoder=%s N=%d K=%d threads=%d frames=%lld unconverged=%lld seconds=%.3f Mbps=%.3f\n",
+			options.decoder.c_str(), codeLength, informationBitSize, options.threadCount, frames, unconverged.load(), seconds,
+			frames * static_cast<double>(informationBitSize) / max(seconds, 1e-9) / 1e6);
+	}
+};
+
+int main(int argc, char** argv) {
+	try {
+		StreamDecoder(StreamOptions::parse(argc, argv)).run();
+	}
+	catch (const exception& error) {
+		fprintf(stderr, "error: %s\n", error.what());
+		return 1;
+	}
+	return 0;
+}